@@ -0,0 +1,87 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+#include <benchmark/benchmark.h>
+#include <Interpret.h>
+#include <Egraph.h>
+#include <TreeOps.h>
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <unordered_set>
+
+namespace {
+std::string readInstance(std::string const & name) {
+    std::ifstream in(std::string(QF_UF_REGRESSION_DIR) + name);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    std::string content = ss.str();
+    // We only want the assertions, not the answer
+    std::string const checkSat = "(check-sat)";
+    for (auto pos = content.find(checkSat); pos != std::string::npos; pos = content.find(checkSat, pos)) {
+        content.erase(pos, checkSat.size());
+    }
+    return content;
+}
+
+std::vector<PTRef> collectEqualities(Logic & logic, vec<PTRef> const & assertions) {
+    std::vector<PTRef> equalities;
+    std::unordered_set<PTRef, PTRefHash> seen;
+    std::vector<PTRef> queue(assertions.begin(), assertions.end());
+    while (not queue.empty()) {
+        PTRef tr = queue.back();
+        queue.pop_back();
+        if (not seen.insert(tr).second) { continue; }
+        if (logic.isTheoryEquality(tr)) {
+            equalities.push_back(tr);
+        }
+        for (PTRef child : logic.getPterm(tr)) {
+            queue.push_back(child);
+        }
+    }
+    std::sort(equalities.begin(), equalities.end(), [](PTRef a, PTRef b) { return a.x < b.x; });
+    return equalities;
+}
+}
+
+// Asserts the equalities of the instance in random orders and reports the merges of equivalence classes per second
+static void merges(benchmark::State & st, char const * instance) {
+    SMTConfig config;
+    Interpret interpret(config);
+    std::string content = readInstance(instance);
+    interpret.interpFile(content.data());
+    Logic & logic = interpret.getMainSolver().getLogic();
+    vec<PTRef> const & assertions = interpret.getAssertions();
+    std::vector<PTRef> equalities = collectEqualities(logic, assertions);
+
+    Egraph egraph(config, logic);
+    AppearsInUfVisitor visitor(logic);
+    for (PTRef tr : assertions) {
+        visitor.visit(tr);
+    }
+    for (PTRef eq : equalities) {
+        egraph.declareAtom(eq);
+    }
+
+    std::mt19937 rng(0);
+    uint64_t const mergesBefore = egraph.getStats().num_merges;
+    for (auto _ : st) {
+        st.PauseTiming();
+        std::shuffle(equalities.begin(), equalities.end(), rng);
+        st.ResumeTiming();
+        egraph.pushBacktrackPoint();
+        for (PTRef eq : equalities) {
+            if (not egraph.assertLit({eq, l_True})) { break; }
+        }
+        egraph.popBacktrackPoint();
+    }
+    auto totalMerges = static_cast<double>(egraph.getStats().num_merges - mergesBefore);
+    st.counters["merges"] = benchmark::Counter(totalMerges, benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_CAPTURE(merges, mpeg_ab_cti_max, "QF_UF-2018-Goel-hwbench-QF_UF_mpeg_ab_cti_max.smt2");
+BENCHMARK_CAPTURE(merges, cache_coherence_three, "2018-Goel-hwbench_QF_UF_cache_coherence_three_ab_cti_max.smt2");
+BENCHMARK_CAPTURE(merges, iso_brn029, "iso_brn029.smt2");
+BENCHMARK_CAPTURE(merges, NEQ004_size4, "NEQ004_size4.smt2");
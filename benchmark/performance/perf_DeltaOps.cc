@@ -0,0 +1,83 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+#include <benchmark/benchmark.h>
+#include <lasolver/Delta.h>
+
+#include <random>
+#include <vector>
+
+// Compares the update of the values of the rows in the column of a non-basic variable, as done by Simplex when the
+// value of the variable changes, written with temporaries (x = x + c * diff) and with the in-place x.addScaled(diff, c).
+// The counter mpqAllocs shows how many mpq values are taken from the pool per update of the column.
+namespace {
+class DeltaUpdateFixture : public ::benchmark::Fixture {
+protected:
+    static constexpr std::size_t columnSize = 64;
+    std::vector<Delta> values;
+    std::vector<Real> coeffs;
+    Delta diff;
+
+    void setUp(bool big) {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> dist(-1000, 1000);
+        Real const scale = big ? Real(INT_MAX) * Real(INT_MAX) * Real(INT_MAX) : Real(1);
+        values.clear();
+        coeffs.clear();
+        for (std::size_t i = 0; i < columnSize; ++i) {
+            values.emplace_back(scale * dist(rng), Real(dist(rng)));
+            coeffs.emplace_back(dist(rng), 1 + std::abs(dist(rng)));
+        }
+        diff = Delta(Real(dist(rng), 7), Real(-1));
+    }
+
+    template<typename UPDATE>
+    void run(benchmark::State & st, UPDATE update) {
+        uint64_t const allocationsBefore = FastRational::mpqAllocations();
+        bool forward = true;
+        for (auto _ : st) {
+            // Alternate the sign of the update so that the values do not grow without bound
+            for (std::size_t i = 0; i < columnSize; ++i) {
+                update(values[i], coeffs[i], forward);
+            }
+            forward = not forward;
+            benchmark::ClobberMemory();
+        }
+        double const allocations = FastRational::mpqAllocations() - allocationsBefore;
+        st.counters["mpqAllocs"] = benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+        st.SetItemsProcessed(st.iterations() * columnSize);
+    }
+
+    void temporaries(benchmark::State & st) {
+        run(st, [this](Delta & x, Real const & c, bool forward) {
+            x = forward ? x + c * diff : x - c * diff;
+        });
+    }
+
+    void inPlace(benchmark::State & st) {
+        run(st, [this](Delta & x, Real const & c, bool forward) {
+            if (forward) { x.addScaled(diff, c); } else { x.subScaled(diff, c); }
+        });
+    }
+};
+}
+
+BENCHMARK_F(DeltaUpdateFixture, WordTemporaries)(benchmark::State & st) {
+    setUp(false);
+    temporaries(st);
+}
+
+BENCHMARK_F(DeltaUpdateFixture, WordInPlace)(benchmark::State & st) {
+    setUp(false);
+    inPlace(st);
+}
+
+BENCHMARK_F(DeltaUpdateFixture, BigTemporaries)(benchmark::State & st) {
+    setUp(true);
+    temporaries(st);
+}
+
+BENCHMARK_F(DeltaUpdateFixture, BigInPlace)(benchmark::State & st) {
+    setUp(true);
+    inPlace(st);
+}
@@ -0,0 +1,90 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+#include <benchmark/benchmark.h>
+#include <lasolver/SparseMatrix.h>
+
+#include <random>
+#include <vector>
+
+// Compares computing the Hermite normal form of a system of sparse integer rows from scratch with keeping it in an
+// IncrementalHermiteNormalForm, when the last rows of the system are replaced between the computations, as happens to
+// the defining constraints of the cuts from proofs between two rounds.  The argument is the number of replaced rows.
+namespace {
+class HNFFixture : public ::benchmark::Fixture {
+protected:
+    static constexpr uint32_t rowCount = 16;
+    static constexpr uint32_t colCount = 24;
+    static constexpr uint32_t termsPerRow = 4;
+    // The pool of rows the replaced rows are taken from
+    std::vector<SparseColMatrix::TermVec> rows;
+
+    void SetUp(benchmark::State const &) override {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> coeff(-7, 7);
+        std::uniform_int_distribution<uint32_t> column(0, colCount - 1);
+        rows.clear();
+        for (uint32_t i = 0; i < 2 * rowCount; ++i) {
+            std::vector<int> dense(colCount, 0);
+            for (uint32_t j = 0; j < termsPerRow; ++j) {
+                int value = coeff(rng);
+                dense[column(rng)] = value != 0 ? value : 1;
+            }
+            SparseColMatrix::TermVec row;
+            for (uint32_t col = 0; col < colCount; ++col) {
+                if (dense[col] != 0) { row.emplace_back(IndexType{col}, dense[col]); }
+            }
+            rows.push_back(std::move(row));
+        }
+    }
+
+    // The rows of the system in the given round: the first rows stay, the last ones alternate between two sets
+    SparseColMatrix::TermVec const & rowOf(uint32_t index, uint32_t replaced, bool odd) const {
+        return odd and index >= rowCount - replaced ? rows[index + rowCount] : rows[index];
+    }
+
+    SparseColMatrix matrixOf(uint32_t replaced, bool odd) const {
+        std::vector<SparseColMatrix::ColumnPolynomial> columns(colCount);
+        for (uint32_t i = 0; i < rowCount; ++i) {
+            for (auto const & [col, value] : rowOf(i, replaced, odd)) {
+                columns[col.x].addTerm(IndexType{i}, value);
+            }
+        }
+        SparseColMatrix matrix(RowCount{rowCount}, ColumnCount{colCount});
+        for (uint32_t col = 0; col < colCount; ++col) {
+            matrix.setColumn(ColIndex{col}, std::move(columns[col]));
+        }
+        return matrix;
+    }
+};
+}
+
+BENCHMARK_DEFINE_F(HNFFixture, FromScratch)(benchmark::State & st) {
+    uint32_t const replaced = st.range(0);
+    bool odd = false;
+    for (auto _ : st) {
+        auto result = HermiteNormalForm()(matrixOf(replaced, odd));
+        benchmark::DoNotOptimize(result.HNFdimension);
+        odd = not odd;
+    }
+}
+
+BENCHMARK_DEFINE_F(HNFFixture, Incremental)(benchmark::State & st) {
+    uint32_t const replaced = st.range(0);
+    IncrementalHermiteNormalForm hnf;
+    for (uint32_t i = 0; i < rowCount; ++i) {
+        hnf.addRow(rowOf(i, replaced, false), colCount);
+    }
+    bool odd = true;
+    for (auto _ : st) {
+        hnf.removeRows(replaced);
+        for (uint32_t i = rowCount - replaced; i < rowCount; ++i) {
+            hnf.addRow(rowOf(i, replaced, odd), colCount);
+        }
+        benchmark::DoNotOptimize(hnf.getDimension());
+        odd = not odd;
+    }
+}
+
+BENCHMARK_REGISTER_F(HNFFixture, FromScratch)->Arg(1)->Arg(4)->Arg(16);
+BENCHMARK_REGISTER_F(HNFFixture, Incremental)->Arg(1)->Arg(4)->Arg(16);
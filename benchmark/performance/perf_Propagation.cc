@@ -0,0 +1,50 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+#include <benchmark/benchmark.h>
+#include <Interpret.h>
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+namespace {
+std::string readInstance(std::string const & name) {
+    std::ifstream in(std::string(QF_UF_REGRESSION_DIR) + name);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    std::string content = ss.str();
+    // The instance is solved by the benchmark, not by the interpreter
+    std::string const checkSat = "(check-sat)";
+    for (auto pos = content.find(checkSat); pos != std::string::npos; pos = content.find(checkSat, pos)) {
+        content.erase(pos, checkSat.size());
+    }
+    return content;
+}
+}
+
+// Solves the instance and reports the unit propagations per second of the search
+static void propagations(benchmark::State & st, char const * instance) {
+    std::string const content = readInstance(instance);
+    uint64_t totalPropagations = 0;
+    for (auto _ : st) {
+        st.PauseTiming();
+        SMTConfig config;
+        auto interpret = std::make_unique<Interpret>(config);
+        std::string input = content;
+        interpret->interpFile(input.data());
+        MainSolver & solver = interpret->getMainSolver();
+        st.ResumeTiming();
+        benchmark::DoNotOptimize(solver.check());
+        st.PauseTiming();
+        totalPropagations += solver.getSMTSolver().propagations;
+        interpret.reset();
+        st.ResumeTiming();
+    }
+    st.counters["propagations"] = benchmark::Counter(static_cast<double>(totalPropagations), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_CAPTURE(propagations, php_3_3_40_unsat, "php_3_3_40_unsat.smt2")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(propagations, NEQ004_size4, "NEQ004_size4.smt2")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(propagations, iso_brn029, "iso_brn029.smt2")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(propagations, mpeg_ab_cti_max, "QF_UF-2018-Goel-hwbench-QF_UF_mpeg_ab_cti_max.smt2")->Unit(benchmark::kMillisecond);
@@ -131,4 +131,82 @@ BENCHMARK_F(RationalEfficiencyFixture, smallSubtraction)(benchmark::State& st) {
         den = std::max<int>(1, (den + 1) % INT32_MAX);
         benchmark::DoNotOptimize(c);
     }
-}
\ No newline at end of file
+}
+// Mixed-width workloads: values of increasing magnitude, most of which do not fit the word representation
+
+class MixedWidthFixture : public ::benchmark::Fixture {
+protected:
+    std::vector<Real> values;
+
+public:
+    void SetUp(const ::benchmark::State& st) {
+        // The argument is the bit-width of the largest numerator and denominator
+        int const maxBits = static_cast<int>(st.range(0));
+        Real const two(2);
+        std::srand(42);
+        values.clear();
+        for (int i = 0; i < 1024; ++i) {
+            Real num(std::rand() % 1000 + 1);
+            Real den(std::rand() % 1000 + 1);
+            for (int bits = 10, widen = std::rand() % maxBits; bits < widen; ++bits) {
+                num *= two;
+                num += std::rand() % 2;
+            }
+            for (int bits = 10, widen = std::rand() % maxBits; bits < widen; ++bits) {
+                den *= two;
+                den += std::rand() % 2;
+            }
+            values.push_back(i % 2 == 0 ? num / den : -num / den);
+        }
+    }
+
+    void TearDown(const ::benchmark::State&) {
+        values.clear();
+    }
+};
+
+BENCHMARK_DEFINE_F(MixedWidthFixture, PairwiseSums)(benchmark::State& st) {
+    Real c;
+    for (auto _ : st) {
+        for (std::size_t i = 1; i < values.size(); ++i) {
+            c = values[i - 1] + values[i];
+            benchmark::DoNotOptimize(c);
+        }
+    }
+}
+BENCHMARK_REGISTER_F(MixedWidthFixture, PairwiseSums)->Arg(31)->Arg(48)->Arg(63)->Arg(96);
+
+BENCHMARK_DEFINE_F(MixedWidthFixture, PairwiseProducts)(benchmark::State& st) {
+    Real c;
+    for (auto _ : st) {
+        for (std::size_t i = 1; i < values.size(); ++i) {
+            c = values[i - 1] * values[i];
+            benchmark::DoNotOptimize(c);
+        }
+    }
+}
+BENCHMARK_REGISTER_F(MixedWidthFixture, PairwiseProducts)->Arg(31)->Arg(48)->Arg(63)->Arg(96);
+
+BENCHMARK_DEFINE_F(MixedWidthFixture, FusedMultiplyAdd)(benchmark::State& st) {
+    Real acc;
+    for (auto _ : st) {
+        for (std::size_t i = 2; i < values.size(); ++i) {
+            acc = values[i - 2];
+            addProductAssign(acc, values[i - 1], values[i]);
+            benchmark::DoNotOptimize(acc);
+        }
+    }
+}
+BENCHMARK_REGISTER_F(MixedWidthFixture, FusedMultiplyAdd)->Arg(31)->Arg(48)->Arg(63)->Arg(96);
+
+BENCHMARK_DEFINE_F(MixedWidthFixture, CopyAndCompare)(benchmark::State& st) {
+    for (auto _ : st) {
+        std::vector<Real> copy(values);
+        std::size_t smaller = 0;
+        for (std::size_t i = 1; i < copy.size(); ++i) {
+            smaller += copy[i - 1] < copy[i];
+        }
+        benchmark::DoNotOptimize(smaller);
+    }
+}
+BENCHMARK_REGISTER_F(MixedWidthFixture, CopyAndCompare)->Arg(31)->Arg(48)->Arg(63)->Arg(96);
@@ -0,0 +1,123 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+#include <benchmark/benchmark.h>
+#include <Interpret.h>
+#include <ArithLogic.h>
+#include <lasolver/Tableau.h>
+#include <lasolver/LAVar.h>
+
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+std::string readInstance(std::string const & name) {
+    std::ifstream in(std::string(QF_LRA_REGRESSION_DIR) + name);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    std::string content = ss.str();
+    // We only want the assertions, not the answer
+    std::string const checkSat = "(check-sat)";
+    for (auto pos = content.find(checkSat); pos != std::string::npos; pos = content.find(checkSat, pos)) {
+        content.erase(pos, checkSat.size());
+    }
+    return content;
+}
+
+// Builds the initial tableau from the linear atoms (sums) of the assertions of the given instance
+Tableau buildTableau(std::string const & name, std::vector<LVRef> & basicVars) {
+    SMTConfig config;
+    Interpret interpret(config);
+    std::string content = readInstance(name);
+    interpret.interpFile(content.data());
+    auto & logic = dynamic_cast<ArithLogic &>(interpret.getMainSolver().getLogic());
+
+    LAVarStore varStore;
+    std::unordered_map<PTRef, LVRef, PTRefHash> vars;
+    auto getVar = [&](PTRef term) {
+        auto it = vars.find(term);
+        if (it != vars.end()) { return it->second; }
+        LVRef v = varStore.getNewVar();
+        vars.insert({term, v});
+        return v;
+    };
+
+    std::vector<PTRef> sums;
+    std::unordered_set<PTRef, PTRefHash> seen;
+    std::vector<PTRef> queue(interpret.getAssertions().begin(), interpret.getAssertions().end());
+    while (not queue.empty()) {
+        PTRef tr = queue.back();
+        queue.pop_back();
+        if (not seen.insert(tr).second) { continue; }
+        if (logic.isLeq(tr)) {
+            PTRef sum = logic.getPterm(tr)[1];
+            if (logic.isPlus(sum) and vars.find(sum) == vars.end()) {
+                getVar(sum);
+                sums.push_back(sum);
+            }
+            continue;
+        }
+        for (PTRef child : logic.getPterm(tr)) {
+            queue.push_back(child);
+        }
+    }
+
+    Tableau tableau;
+    std::vector<std::pair<LVRef, std::unique_ptr<Tableau::Polynomial>>> rows;
+    for (PTRef sum : sums) {
+        auto poly = std::make_unique<Tableau::Polynomial>();
+        for (PTRef arg : logic.getPterm(sum)) {
+            auto [v, c] = logic.splitTermToVarAndConst(arg);
+            poly->addTerm(getVar(v), logic.getNumConst(c));
+        }
+        rows.emplace_back(vars.at(sum), std::move(poly));
+    }
+    for (auto const & [term, var] : vars) {
+        if (not logic.isPlus(term)) {
+            tableau.newNonbasicVar(var);
+        }
+    }
+    for (auto & [var, poly] : rows) {
+        tableau.newRow(var, std::move(poly));
+        tableau.quasiToBasic(var);
+        basicVars.push_back(var);
+    }
+    return tableau;
+}
+
+}
+
+static void pivots(benchmark::State & st, char const * instance) {
+    std::vector<LVRef> initialBasicVars;
+    Tableau const initial = buildTableau(instance, initialBasicVars);
+    std::size_t const pivotsPerRound = 2 * initialBasicVars.size();
+    std::size_t totalPivots = 0;
+    for (auto _ : st) {
+        st.PauseTiming();
+        Tableau tableau = initial;
+        std::vector<LVRef> basicVars = initialBasicVars;
+        std::mt19937 rng(0);
+        st.ResumeTiming();
+        for (std::size_t i = 0; i < pivotsPerRound; ++i) {
+            std::size_t index = rng() % basicVars.size();
+            LVRef basic = basicVars[index];
+            auto const & rowVars = tableau.getRowPoly(basic).getVars();
+            if (rowVars.empty()) { continue; }
+            LVRef nonBasic = rowVars[rng() % rowVars.size()];
+            tableau.pivot(basic, nonBasic);
+            basicVars[index] = nonBasic;
+            ++totalPivots;
+        }
+        benchmark::DoNotOptimize(tableau);
+    }
+    st.counters["pivots"] = benchmark::Counter(static_cast<double>(totalPivots), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_CAPTURE(pivots, simple_startup, "simple_startup_3nodes.abstract.base.smt2");
+BENCHMARK_CAPTURE(pivots, sc_5_induction, "sc-5.induction.cvc.smt2");
+BENCHMARK_CAPTURE(pivots, pd_finish, "pd_finish.induction.smt2");
+BENCHMARK_CAPTURE(pivots, machine_shop, "constraints-temporal-machine-shop-2-3-A04.smt2");
+BENCHMARK_CAPTURE(pivots, clocksynchro, "clocksynchro_2clocks.worst_case_skew.induct.smt2");
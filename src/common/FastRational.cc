@@ -8,21 +8,59 @@ Copyright (c) 2008, 2009 Centre national de la recherche scientifique (CNRS)
 #include <sstream>
 #include <algorithm>
 
+namespace {
+mpq_ptr createMpq()
+{
+    mpq_ptr r = new __mpq_struct;
+    mpq_init(r);
+    return r;
+}
+
+void destroyMpq(mpq_ptr ptr)
+{
+    mpq_clear(ptr);
+    delete ptr;
+}
+}
+
 mpq_ptr FastRational::mpqPool::alloc()
 {
-    mpq_ptr r;
-    if (!pool.empty()) {
-        r = pool.top();
-        pool.pop();
-    } else {
-        r = store.emplace().get_mpq_t();
+    ++allocations;
+    if (cached > 0) {
+        return cache[--cached];
     }
-    return r;
+    return createMpq();
 }
 
 void FastRational::mpqPool::release(mpq_ptr ptr)
 {
-    pool.push(ptr);
+    if (not cache) {
+        if (threadExited) {
+            destroyMpq(ptr);
+            return;
+        }
+        // Clears the cache of this thread when the thread exits
+        struct Cleaner {
+            ~Cleaner() { pool.clear(); }
+        };
+        static thread_local Cleaner cleaner;
+        cache = new mpq_ptr[maxCached];
+    }
+    if (cached == maxCached) {
+        std::for_each(cache, cache + maxCached / 2, destroyMpq);
+        std::copy(cache + maxCached / 2, cache + maxCached, cache);
+        cached -= maxCached / 2;
+    }
+    cache[cached++] = ptr;
+}
+
+void FastRational::mpqPool::clear()
+{
+    std::for_each(cache, cache + cached, destroyMpq);
+    delete[] cache;
+    cache = nullptr;
+    cached = 0;
+    threadExited = true;
 }
 
 FastRational::FastRational( const char * s, const int base )
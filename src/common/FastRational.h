@@ -11,7 +11,6 @@ Copyright (c) 2008, 2009 Centre national de la recherche scientifique (CNRS)
 #include <cassert>
 #include <climits>
 #include "Vec.h"
-#include <stack>
 #include <vector>
 
 typedef int32_t  word;
@@ -69,20 +68,27 @@ inline ulword absVal(lword x) {
 
 class FastRational
 {
-    class mpqPool
+    // Cache of initialised mpq values owned by one thread.  A value is returned to the cache of the thread releasing
+    // it, whichever thread allocated it, so no synchronisation is needed.  When the cache is full, the older half of it
+    // is cleared in one go.  The cache is plain data, so accessing it needs no per-access initialisation check; its
+    // memory is freed when the thread exits, after which released values are cleared directly.
+    struct mpqPool
     {
-        std::stack<mpq_class> store; // uses deque as storage to avoid realloc
-        std::stack<mpq_ptr, std::vector<mpq_ptr>> pool;
-    public:
+        static constexpr uint32_t maxCached = 4096;
+        mpq_ptr * cache;
+        uint32_t cached;
+        bool threadExited;
+        uint64_t allocations; // Number of times an mpq was taken from the pool, for profiling
         mpq_ptr alloc();
         void release(mpq_ptr);
+        void clear();
     };
     State state;
     word num{0};
     uword den{1};
     mpq_ptr mpq{nullptr};
 
-    inline static mpqPool pool;
+    inline static thread_local mpqPool pool;
     inline static thread_local mpz_class temp;
     inline static mpz_ptr mpz() { return temp.get_mpz_t(); }
 
@@ -115,6 +121,8 @@ public:
     inline bool wordAndMpqEqual() const;
     inline bool mpqMemoryAllocated() const { return  static_cast<state_t>(state) & mpqMemoryAllocatedMask; }
     inline bool mpqPartValid() const { return  static_cast<state_t>(state) & mpqValidMask; }
+    // Number of mpq values handed out so far in this thread, i.e., how many times a value had to leave the word representation
+    static uint64_t mpqAllocations() { return pool.allocations; }
 
     //
     // Constructors
@@ -202,6 +210,11 @@ private:
     friend inline void substractionAssign  (FastRational &, const FastRational &);
     friend inline void multiplicationAssign(FastRational &, const FastRational &);
     friend inline void divisionAssign      (FastRational &, const FastRational &);
+    friend inline bool addProductAssign    (FastRational &, const FastRational &, const FastRational &);
+    friend inline bool subProductAssign    (FastRational &, const FastRational &, const FastRational &);
+    friend inline bool integerProducts     (const FastRational *, std::size_t, const FastRational &, int64_t *);
+    friend inline bool addIntegerAssign    (FastRational &, int64_t);
+    friend inline bool assignInteger       (FastRational &, int64_t);
     friend FastRational gcd                (FastRational const &, FastRational const &);
     friend FastRational lcm                (FastRational const &, FastRational const &);
     friend FastRational fastrat_fdiv_q     (FastRational const & n, FastRational const & d);
@@ -619,7 +632,7 @@ inline FastRational::FastRational(word n, uword d) : state{State::WORD_VALID} {
     } else {
         uword common = gcd<uword>(absVal(n), d);
         if (common > 1) {
-            num = n / common;
+            num = word(lword(n) / common);
             den = d / common;
         } else {
             num = n;
@@ -875,24 +888,29 @@ inline void additionAssign(FastRational& a, const FastRational& b) {
             } else if (a.num == 0) {
                 a.num = b.num;
                 a.den = b.den;
+            } else if (a.den == 1) {
+                CHECK_WORD(a.num, lword(b.num) + lword(a.num)*b.den);
+                a.den = b.den;
             } else {
-                lword c1 = lword(a.num)*b.den; // No overflow
-                lword c2 = lword(b.num)*a.den; // No overflow
+                // Sum of reduced fractions, see Knuth, TAOCP Vol. 2, 4.5.1: only the common factor of the
+                // denominators can divide the result, so the expensive gcd with the full product is not needed
+                uword common = gcd(a.den, b.den);
+                lword c1 = lword(a.num) * (b.den / common); // No overflow
+                lword c2 = lword(b.num) * (a.den / common); // No overflow
                 lword n;
                 CHECK_SUM_OVERFLOWS_LWORD(n, c1, c2); // Overflow possible
-                ulword d = ulword(a.den) * b.den;
-                lword common = gcd(absVal(n), d);
-                word zn;
-                uword zd;
-                if (common > 1) {
-                    CHECK_WORD(zn, n/common);
-                    CHECK_UWORD(zd, d/common);
+                if (n == 0) {
+                    a.num = 0;
+                    a.den = 1;
                 } else {
-                    CHECK_WORD(zn, n);
-                    CHECK_UWORD(zd, d);
+                    uword common2 = common == 1 ? 1 : gcd<uword>(uword(absVal(n) % common), common);
+                    word zn;
+                    uword zd;
+                    CHECK_WORD(zn, n / common2);
+                    CHECK_UWORD(zd, ulword(a.den / common) * (b.den / common2));
+                    a.num = zn;
+                    a.den = zd;
                 }
-                a.num = zn;
-                a.den = zd;
             }
             a.setOnlyWordPartValid();
             assert(a.isWellFormed());
@@ -1003,6 +1021,102 @@ inline void divisionAssign(FastRational& a, const FastRational& b) {
     a.try_fit_word();
 }
 
+// Computes dst += a * b in one step.
+// When all three values are in word representation, the product and the sum are computed with 64-bit and 128-bit
+// intermediate values and the result is reduced only once, without creating any temporary FastRational.
+// Otherwise, or when the result does not fit into a word, the general path is taken.
+// Returns true if the result was computed in machine words.
+inline bool addProductAssign(FastRational& dst, const FastRational& a, const FastRational& b) {
+    if (dst.wordPartValid() && a.wordPartValid() && b.wordPartValid()) {
+        if (a.num == 0 || b.num == 0) { return true; }
+        if (dst.den == 1 && a.den == 1 && b.den == 1) {
+            // |a.num * b.num| <= 2^62, so the sum cannot overflow lword
+            CHECK_WORD(dst.num, lword(dst.num) + lword(a.num) * b.num);
+        } else {
+            // The product is reduced by cross-cancelling, as in multiplication
+            uword common1 = gcd(absVal(a.num), b.den);
+            uword common2 = gcd(a.den, absVal(b.num));
+            // Divisions are expensive, skip them in the frequent case of coprime values
+            lword pn = (common1 == 1 ? lword(a.num) : lword(a.num) / common1) * (common2 == 1 ? lword(b.num) : lword(b.num) / common2); // |pn| <= 2^62
+            ulword pd = ulword(common2 == 1 ? a.den : a.den / common2) * (common1 == 1 ? b.den : b.den / common1);
+            if (pn >= WORD_MIN and pn <= WORD_MAX and pd <= UWORD_MAX) {
+                // The product fits into a word, so the usual word addition applies
+                FastRational product;
+                product.num = word(pn);
+                product.den = uword(pd);
+                additionAssign(dst, product);
+                return dst.wordPartValid();
+            }
+            // Sum of reduced fractions, see Knuth, TAOCP Vol. 2, 4.5.1
+            ulword g = gcd<ulword>(dst.den, pd);
+            __int128 t = __int128(dst.num) * (pd / g) + __int128(pn) * (dst.den / g); // |t| < 2^96
+            if (t == 0) {
+                dst.num = 0;
+                dst.den = 1;
+            } else {
+                unsigned __int128 absT = t < 0 ? -(unsigned __int128)(t) : (unsigned __int128)(t);
+                ulword g2 = g == 1 ? 1 : gcd<ulword>(ulword(absT % g), g);
+                __int128 n = t / g2;
+                unsigned __int128 d = (unsigned __int128)(dst.den / g) * (pd / g2);
+                if (n < WORD_MIN || n > WORD_MAX || d > UWORD_MAX) {
+                    goto overflow;
+                }
+                dst.num = word(n);
+                dst.den = uword(d);
+            }
+        }
+        dst.setOnlyWordPartValid();
+        assert(dst.isWellFormed());
+        return true;
+    }
+    overflow:
+    FastRational product;
+    multiplication(product, a, b);
+    additionAssign(dst, product);
+    return false;
+}
+
+// Computes dst -= a * b in one step, see addProductAssign.
+// Negation is done in place, so this does not create any temporary either.
+inline bool subProductAssign(FastRational& dst, const FastRational& a, const FastRational& b) {
+    dst.negate();
+    bool inWords = addProductAssign(dst, a, b);
+    dst.negate();
+    return inWords;
+}
+
+// Batched kernel for combining rows of integer coefficients, see TableauRow::merge.
+// Computes out[k] = a[k] * b for all 0 <= k < n if b and all a[k] are integers in word representation; the products
+// then cannot overflow.  Returns false, leaving out unspecified, as soon as some value is not a word integer.
+inline bool integerProducts(const FastRational* a, std::size_t n, const FastRational& b, int64_t* out) {
+    if (not b.wordPartValid() or b.den != 1) { return false; }
+    for (std::size_t k = 0; k < n; ++k) {
+        if (not a[k].wordPartValid() or a[k].den != 1) { return false; }
+        out[k] = lword(a[k].num) * b.num;
+    }
+    return true;
+}
+
+// Computes dst += v, where |v| <= 2^62, if dst is an integer in word representation and the result fits into a word.
+// Returns false, leaving dst unchanged, otherwise.
+inline bool addIntegerAssign(FastRational& dst, int64_t v) {
+    if (not dst.wordPartValid() or dst.den != 1) { return false; }
+    lword sum = lword(dst.num) + v;
+    if (sum < WORD_MIN or sum > WORD_MAX) { return false; }
+    dst.num = word(sum);
+    dst.setOnlyWordPartValid();
+    return true;
+}
+
+// Sets dst to v if v fits into a word; returns false, leaving dst unchanged, otherwise.
+inline bool assignInteger(FastRational& dst, int64_t v) {
+    if (v < WORD_MIN or v > WORD_MAX) { return false; }
+    dst.num = word(v);
+    dst.den = 1;
+    dst.setOnlyWordPartValid(); // keeps the mpq memory allocated if it already is
+    return true;
+}
+
 inline unsigned FastRational::size() const {
     if (wordPartValid()) return 64;
     return mpz_sizeinbase(mpq_numref(mpq), 2) + mpz_sizeinbase(mpq_denref(mpq), 2);
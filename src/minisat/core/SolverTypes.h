@@ -142,7 +142,9 @@ class Clause {
         unsigned has_extra : 1;
         unsigned reloced   : 1;
         unsigned glue      : 3;
-        unsigned size      : 24; }                            header;
+        unsigned used      : 1;
+        unsigned vivified  : 1;
+        unsigned size      : 22; }                            header;
     union { Lit lit; float act; uint32_t abs; CRef rel; } data[0];
 
     friend class ClauseAllocator;
@@ -156,6 +158,8 @@ class Clause {
         header.reloced   = 0;
         header.size      = ps.size();
         header.glue      = 7;
+        header.used      = 0;
+        header.vivified  = 0;
 
         for (unsigned i = 0; i < (unsigned)ps.size(); i++)
             data[i].lit = ps[i];
@@ -208,6 +212,12 @@ public:
         assert(glue < 8);
         header.glue = glue;
     }
+    // Whether the learnt clause took part in conflict analysis since the last reduction of the learnt clauses
+    bool         used        ()      const   { return header.used; }
+    void         setUsed     (bool u)        { header.used = u; }
+    // Whether the learnt clause has been vivified by the inprocessing
+    bool         vivified    ()      const   { return header.vivified; }
+    void         setVivified (bool v)        { header.vivified = v; }
 };
 
 
@@ -254,6 +264,8 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
     Clause*       lea       (Ref r)       { return (Clause*)RegionAllocator<uint32_t>::lea(r); }
     const Clause* lea       (Ref r) const { return (Clause*)RegionAllocator<uint32_t>::lea(r); }
     Ref           ael       (const Clause* t){ return RegionAllocator<uint32_t>::ael((uint32_t*)t); }
+    // Hints the cpu to start loading the header and the first literals of the clause
+    void          prefetch  (Ref r) const { __builtin_prefetch(lea(r)); }
 
     void free(CRef cid)
     {
@@ -273,6 +285,8 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
         // Copy extra data-fields:
         // (This could be cleaned-up. Generalize Clause-constructor to be applicable here instead?)
         to[cr].mark(c.mark());
+        to[cr].setUsed(c.used());
+        to[cr].setVivified(c.vivified());
         if (to[cr].learnt())         to[cr].activity() = c.activity();
         else if (to[cr].has_extra()) to[cr].calcAbstraction();
     }
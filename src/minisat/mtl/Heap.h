@@ -133,16 +133,18 @@ class Heap {
         assert(inHeap(n));
         // Retrieve position of n in the heap
         int ind = indices[n];
-        // Replace n with what is bigger in the heap
-        heap[ind] = heap.last( );
-        // Save new indices for that bigger variable
-        indices[heap[ind]] = ind;
-        // Percolate down bigger variable
+        int last = heap.last( );
         heap.pop( );
-        // Percolate down
-        if ( heap.size( ) > 1 ) percolateDown(ind);
         // Detach n
         indices[n] = -1;
+        if ( last != n ) {
+            // Replace n with the last element of the heap
+            heap[ind] = last;
+            indices[last] = ind;
+            // The last element can be smaller than the parent of n or bigger than its children
+            percolateUp(ind);
+            percolateDown(indices[last]);
+        }
         assert(!inHeap(n));
     }
 
@@ -413,6 +413,32 @@ bool SMTConfig::setOption(const char* name, const SMTOption& value, const char*&
             strcmp(val, spts_search_counter) != 0)
         { msg = s_err_unknown_units; return false; }
     }
+    if (strcmp(name, o_lra_pivot_rule) == 0) {
+        if (value.getValue().type != O_STR) { msg = s_err_not_str; return false; }
+        const char* val = value.getValue().strval;
+        if (strcmp(val, lra_pivot_rules_shortest_row) != 0 &&
+            strcmp(val, lra_pivot_rules_steepest_edge) != 0)
+        { msg = s_err_unknown_pivot_rule; return false; }
+    }
+    if (strcmp(name, o_sat_reduce_db) == 0) {
+        if (value.getValue().type != O_STR) { msg = s_err_not_str; return false; }
+        const char* val = value.getValue().strval;
+        if (strcmp(val, sat_reduce_dbs_activity) != 0 &&
+            strcmp(val, sat_reduce_dbs_tiered) != 0)
+        { msg = s_err_unknown_reduce_db; return false; }
+    }
+    if (strcmp(name, o_sat_chrono_backtrack) == 0 || strcmp(name, o_sat_mode_switch_conflicts) == 0
+        || strcmp(name, o_sat_rephase_interval) == 0) {
+        if (value.getValue().type != O_NUM) { msg = s_err_not_num; return false; }
+    }
+    if (strcmp(name, o_sat_search_mode) == 0) {
+        if (value.getValue().type != O_STR) { msg = s_err_not_str; return false; }
+        const char* val = value.getValue().strval;
+        if (strcmp(val, sat_search_modes_stable) != 0 &&
+            strcmp(val, sat_search_modes_focused) != 0 &&
+            strcmp(val, sat_search_modes_alternate) != 0)
+        { msg = s_err_unknown_search_mode; return false; }
+    }
     if (optionTable.has(name))
         optionTable.remove(name);
     insertOption(name, new SMTOption(value));
@@ -487,6 +513,7 @@ const char* SMTConfig::o_itp_bool_alg = ":interpolation-bool-algorithm";
 const char* SMTConfig::o_itp_euf_alg = ":interpolation-euf-algorithm";
 const char* SMTConfig::o_itp_lra_alg = ":interpolation-lra-algorithm";
 const char* SMTConfig::o_itp_lra_factor = ":interpolation-lra-factor";
+const char* SMTConfig::o_lra_pivot_rule = ":lra-pivot-rule";
 const char* SMTConfig::o_sat_resource_units = ":resource-units";
 const char* SMTConfig::o_sat_resource_limit = ":resource-limit";
 const char* SMTConfig::o_dump_state = ":dump-state";
@@ -505,6 +532,14 @@ const char* SMTConfig::o_sat_split_num = ":split-num";
 const char* SMTConfig::o_sat_split_fix_vars = ":split-fix-vars";
 const char* SMTConfig::o_sat_split_asap = ":split-asap";
 const char* SMTConfig::o_sat_split_units = ":split-units";
+const char* SMTConfig::o_sat_reduce_db = ":sat-reduce-db";
+const char* SMTConfig::o_sat_chrono_backtrack = ":sat-chrono-backtrack";
+const char* SMTConfig::o_sat_search_mode = ":sat-search-mode";
+const char* SMTConfig::o_sat_mode_switch_conflicts = ":sat-mode-switch-conflicts";
+const char* SMTConfig::o_sat_target_phase = ":sat-target-phase";
+const char* SMTConfig::o_sat_rephase_interval = ":sat-rephase-interval";
+const char* SMTConfig::o_sat_inprocess = ":sat-inprocess";
+const char* SMTConfig::o_sat_eager_theory_assertion = ":sat-eager-theory-assertion";
 const char* SMTConfig::o_sat_split_preference = ":split-preference";
 const char* SMTConfig::o_sat_split_test_cube_and_conquer = ":test-cube-and-conquer";
 const char* SMTConfig::o_sat_split_randomize_lookahead = ":randomize-lookahead";
@@ -533,6 +568,9 @@ const char* SMTConfig::s_err_not_num = "expected number";
 const char* SMTConfig::s_err_seed_zero = "seed cannot be 0";
 const char* SMTConfig::s_err_unknown_split = "unknown split type";
 const char* SMTConfig::s_err_unknown_units = "unknown split units";
+const char* SMTConfig::s_err_unknown_pivot_rule = "unknown pivot rule";
+const char* SMTConfig::s_err_unknown_reduce_db = "unknown learnt clause reduction";
+const char* SMTConfig::s_err_unknown_search_mode = "unknown search mode";
 
 void
 SMTConfig::initializeConfig( )
@@ -175,6 +175,30 @@ static const struct ItpAlgorithm itp_lra_alg_decomposing_strong  = {4 };
 static const struct ItpAlgorithm itp_lra_alg_decomposing_weak  = {5 };
 static const char *itp_lra_factor_0 = "1/2";
 
+// Rule for choosing the basic variable to fix in simplex
+struct LRAPivotRule { int x; bool operator==(const LRAPivotRule& o) const { return x == o.x; }};
+static const struct LRAPivotRule lra_pivot_rule_shortest_row  = { 0 };
+static const struct LRAPivotRule lra_pivot_rule_steepest_edge = { 1 };
+static const char* const lra_pivot_rules_shortest_row  = "shortest-row";
+static const char* const lra_pivot_rules_steepest_edge = "steepest-edge";
+
+// Policy for removing learnt clauses in the SAT solver
+struct SatReduceDB { int x; bool operator==(const SatReduceDB& o) const { return x == o.x; }};
+static const struct SatReduceDB sat_reduce_db_activity = { 0 };
+static const struct SatReduceDB sat_reduce_db_tiered   = { 1 };
+static const char* const sat_reduce_dbs_activity = "activity";
+static const char* const sat_reduce_dbs_tiered   = "tiered";
+
+// Search mode of the SAT solver: stable (long restarts, optionally target phases), focused (frequent restarts, fast decay),
+// or alternating between the two
+struct SatSearchMode { int x; bool operator==(const SatSearchMode& o) const { return x == o.x; }};
+static const struct SatSearchMode sat_search_mode_stable    = { 0 };
+static const struct SatSearchMode sat_search_mode_focused   = { 1 };
+static const struct SatSearchMode sat_search_mode_alternate = { 2 };
+static const char* const sat_search_modes_stable    = "stable";
+static const char* const sat_search_modes_focused   = "focused";
+static const char* const sat_search_modes_alternate = "alternate";
+
 inline bool operator==(const SpType& s1, const SpType& s2) { return s1.t == s2.t; }
 inline bool operator!=(const SpType& s1, const SpType& s2) { return s1.t != s2.t; }
 inline bool operator==(const SpPref& s1, const SpPref& s2) { return s1.t == s2.t; }
@@ -275,6 +299,7 @@ public:
   static const char* o_itp_euf_alg;
   static const char* o_itp_lra_alg;
   static const char* o_itp_lra_factor;
+  static const char* o_lra_pivot_rule;
   static const char* o_sat_dump_rnd_inter;
   static const char* o_sat_resource_units;
   static const char* o_sat_resource_limit;
@@ -297,6 +322,14 @@ public:
   static const char* o_sat_pure_lookahead;
   static const char* o_lookahead_score_deep;
   static const char* o_sat_split_units;
+  static const char* o_sat_reduce_db;
+  static const char* o_sat_chrono_backtrack;
+  static const char* o_sat_search_mode;
+  static const char* o_sat_mode_switch_conflicts;
+  static const char* o_sat_target_phase;
+  static const char* o_sat_rephase_interval;
+  static const char* o_sat_inprocess;
+  static const char* o_sat_eager_theory_assertion;
   static const char* o_sat_split_preference;
   static const char* o_sat_split_test_cube_and_conquer;
   static const char* o_sat_split_randomize_lookahead;
@@ -320,6 +353,9 @@ private:
   static const char* s_err_seed_zero;
   static const char* s_err_unknown_split;
   static const char* s_err_unknown_units;
+  static const char* s_err_unknown_pivot_rule;
+  static const char* s_err_unknown_reduce_db;
+  static const char* s_err_unknown_search_mode;
 
 
   Info          info_Empty;
@@ -449,6 +485,10 @@ public:
   inline void setLRAInterpolationAlgorithm( ItpAlgorithm i ) { insertOption(o_itp_lra_alg, new SMTOption(i.x)); }
 
   inline void setLRAStrengthFactor(const char *factor) { insertOption(o_itp_lra_factor, new SMTOption(factor)); }
+  inline void setLRAPivotRule(const char *rule) { insertOption(o_lra_pivot_rule, new SMTOption(rule)); }
+  inline void setSatReduceDB(const char *policy) { insertOption(o_sat_reduce_db, new SMTOption(policy)); }
+  inline void setSatChronoBacktrack(int threshold) { insertOption(o_sat_chrono_backtrack, new SMTOption(threshold)); }
+  inline void setSatSearchMode(const char *mode) { insertOption(o_sat_search_mode, new SMTOption(mode)); }
 
   inline void setInstanceName(const char* name) { insertOption(o_inst_name, new SMTOption(name)); }
 
@@ -615,6 +655,13 @@ public:
   int itp_euf_alg() const
     { return optionTable.has(o_itp_euf_alg) ?
         optionTable[o_itp_euf_alg]->getValue().numval : 0; }
+  LRAPivotRule lra_pivot_rule() const {
+      if (optionTable.has(o_lra_pivot_rule)) {
+          const char* rule = optionTable[o_lra_pivot_rule]->getValue().strval;
+          if (strcmp(rule, lra_pivot_rules_steepest_edge) == 0) return lra_pivot_rule_steepest_edge;
+      }
+      return lra_pivot_rule_shortest_row;
+  }
   int itp_lra_alg() const
     { return optionTable.has(o_itp_lra_alg) ?
         optionTable[o_itp_lra_alg]->getValue().numval : 0; }
@@ -728,6 +775,51 @@ public:
       return SpUnit::search_counter;
   }
 
+  SatReduceDB sat_reduce_db() const {
+      if (optionTable.has(o_sat_reduce_db)) {
+          const char* policy = optionTable[o_sat_reduce_db]->getValue().strval;
+          if (strcmp(policy, sat_reduce_dbs_activity) == 0) return sat_reduce_db_activity;
+      }
+      return sat_reduce_db_tiered;
+  }
+  // Backjumps over more than this many decision levels only undo the last level; 0 disables
+  int sat_chrono_backtrack() const {
+      return optionTable.has(o_sat_chrono_backtrack) ?
+              optionTable[o_sat_chrono_backtrack]->getValue().numval :
+              100; }
+  SatSearchMode sat_search_mode() const {
+      if (optionTable.has(o_sat_search_mode)) {
+          const char* mode = optionTable[o_sat_search_mode]->getValue().strval;
+          if (strcmp(mode, sat_search_modes_focused) == 0) return sat_search_mode_focused;
+          if (strcmp(mode, sat_search_modes_alternate) == 0) return sat_search_mode_alternate;
+      }
+      return sat_search_mode_stable;
+  }
+  // Conflicts spent in the first mode when alternating; every following mode gets this many more
+  int sat_mode_switch_conflicts() const {
+      return optionTable.has(o_sat_mode_switch_conflicts) ?
+              optionTable[o_sat_mode_switch_conflicts]->getValue().numval :
+              1000; }
+  bool sat_target_phase() const {
+      return optionTable.has(o_sat_target_phase) ?
+              optionTable[o_sat_target_phase]->getValue().numval > 0 :
+              false; }
+  // Conflicts between the first two rephasings, growing arithmetically; 0 disables rephasing
+  int sat_rephase_interval() const {
+      return optionTable.has(o_sat_rephase_interval) ?
+              optionTable[o_sat_rephase_interval]->getValue().numval :
+              0; }
+  // Vivify the learnt clauses between restarts
+  bool sat_inprocess() const {
+      return optionTable.has(o_sat_inprocess) ?
+              optionTable[o_sat_inprocess]->getValue().numval > 0 :
+              true; }
+  // Assert the literals to the theory solvers during unit propagation
+  bool sat_eager_theory_assertion() const {
+      return optionTable.has(o_sat_eager_theory_assertion) ?
+              optionTable[o_sat_eager_theory_assertion]->getValue().numval > 0 :
+              false; }
+
   double sat_split_inittune() const {
       return optionTable.has(o_sat_split_inittune) ?
               optionTable[o_sat_split_inittune]->getValue().getDoubleVal() :
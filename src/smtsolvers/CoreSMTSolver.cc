@@ -91,6 +91,15 @@ CoreSMTSolver::CoreSMTSolver(SMTConfig & c, THandler& t )
       // More parameters:
       //
     , expensive_ccmin  ( true )
+    , reduce_db        (c.sat_reduce_db())
+    , chrono_backtrack (c.sat_chrono_backtrack())
+    , search_mode      (c.sat_search_mode())
+    , mode_switch_conflicts(c.sat_mode_switch_conflicts())
+    , target_phase     (c.sat_target_phase())
+    , rephase_interval (c.sat_rephase_interval())
+    , stable_var_decay (c.sat_var_decay())
+    , inprocess_learnts(c.sat_inprocess())
+    , eager_theory_assertion(c.sat_eager_theory_assertion())
     , learntsize_adjust_start_confl (0)
       // Statistics: (formerly in 'SolverStats')
       //
@@ -100,6 +109,9 @@ CoreSMTSolver::CoreSMTSolver(SMTConfig & c, THandler& t )
     , learnts_size(0) , all_learnts(0)
     , learnt_theory_conflicts(0)
     , top_level_lits        (0)
+    , chrono_backtracks     (0)
+    , saved_theory_assertions(0)
+    , propagation_theory_conflicts(0)
 
     , ok                    (true)
     , conflict_frame        (0)
@@ -107,6 +119,7 @@ CoreSMTSolver::CoreSMTSolver(SMTConfig & c, THandler& t )
     , cla_inc               (1)
     , var_inc               (1)
     , watches               (WatcherDeleted(ca))
+    , watchesBin            (WatcherDeleted(ca))
     , qhead                 (0)
     , simpDB_assigns        (-1)
     , simpDB_props          (0)
@@ -205,6 +218,8 @@ Var CoreSMTSolver::newVar(bool dvar)
     int v = nVars();
     watches  .init(mkLit(v, false));
     watches  .init(mkLit(v, true));
+    watchesBin.init(mkLit(v, false));
+    watchesBin.init(mkLit(v, true));
     assigns  .push(l_Undef);
     vardata  .push(mkVarData(CRef_Undef, 0));
     activity .push(rnd_init_act ? opensmt::drand(random_seed) * 0.00001 : 0);
@@ -213,6 +228,8 @@ Var CoreSMTSolver::newVar(bool dvar)
     trail    .capacity(v+1);
     setDecisionVar(v, dvar);
     savedPolarity.push(true);
+    targetPolarity.push(l_Undef);
+    deductionTokens.push(DeductionToken_Undef);
 
     this->var_seen.push(false);
 
@@ -321,8 +338,9 @@ void CoreSMTSolver::attachClause(CRef cr)
     const Clause& c = ca[cr];
     assert(c.size() > 1);
     assert(value(c[0]) != l_False or value(c[1]) != l_False);
-    watches[~c[0]].push(Watcher(cr, c[1]));
-    watches[~c[1]].push(Watcher(cr, c[0]));
+    auto & ws = c.size() == 2 ? watchesBin : watches;
+    ws[~c[0]].push(Watcher(cr, c[1]));
+    ws[~c[1]].push(Watcher(cr, c[0]));
     if (c.learnt()) learnts_literals += c.size();
     else            clauses_literals += c.size();
 }
@@ -331,16 +349,17 @@ void CoreSMTSolver::detachClause(CRef cr, bool strict)
 {
     const Clause& c = ca[cr];
     assert(c.size() > 1);
+    auto & ws = c.size() == 2 ? watchesBin : watches;
     if (strict)
     {
-        remove(watches[~c[0]], Watcher(cr, c[1]));
-        remove(watches[~c[1]], Watcher(cr, c[0]));
+        remove(ws[~c[0]], Watcher(cr, c[1]));
+        remove(ws[~c[1]], Watcher(cr, c[0]));
     }
     else
     {
         // Lazy detaching: (NOTE! Must clean all watcher lists before garbage collecting this clause)
-        watches.smudge(~c[0]);
-        watches.smudge(~c[1]);
+        ws.smudge(~c[0]);
+        ws.smudge(~c[1]);
     }
 
     if (c.learnt()) learnts_literals -= c.size();
@@ -549,10 +568,17 @@ Lit CoreSMTSolver::choosePolarity(Var next) {
             return mkLit(next, sign);
         }
     }
-    sign = (savedPolarity[next] == flipState);
+    sign = savedSign(next);
     return mkLit(next, sign);
 }
 
+bool CoreSMTSolver::savedSign(Var v) const {
+    if (stableMode and target_phase and not flipState and targetPolarity[v] != l_Undef) {
+        return targetPolarity[v] == l_False;
+    }
+    return savedPolarity[v] == flipState;
+}
+
 //=================================================================================================
 // Major methods:
 
@@ -622,6 +648,7 @@ void CoreSMTSolver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
             claBumpActivity(c);
             const uint32_t newGlue = computeGlue(c);
             if (newGlue < c.getGlue()) c.setGlue(newGlue);
+            c.setUsed(true);
         }
 
         for (unsigned j = (p == lit_Undef) ? 0 : 1; j < c.size(); j++)
@@ -670,7 +697,7 @@ void CoreSMTSolver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
 #ifdef STATISTICS
             const double start = cpuTime( );
 #endif
-            theory_handler.getReason(p, r);
+            theory_handler.getReason(p, deductionTokens[var(p)], r);
             assert(r.size() > 0);
 #ifdef STATISTICS
             tsolvers_time += cpuTime( ) - start;
@@ -824,6 +851,33 @@ void CoreSMTSolver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
 //    printf("\n");
 }
 
+/*_________________________________________________________________________________________________
+|
+|  conflictBacktrackLevel : (learnt : const vec<Lit>&) (btlevel : int)  ->  [int]
+|
+|  Description:
+|    Returns the level to backtrack to after learning the asserting clause 'learnt' whose asserting
+|    level is 'btlevel'.  A backjump over more than 'chrono_backtrack' levels would retract all the
+|    literals of the skipped levels from the theory solvers only for most of them to be asserted again
+|    right after.  Such a backjump is replaced by undoing only the conflicting level.  The asserting
+|    literal is then implied at the level below the conflict, which is higher than needed but keeps
+|    the levels on the trail monotone.  Unit clauses always go to level 0.
+|________________________________________________________________________________________________@*/
+int CoreSMTSolver::conflictBacktrackLevel(vec<Lit> const & learnt, int btlevel)
+{
+    int const chronoLevel = decisionLevel() - 1;
+    if (chrono_backtrack <= 0 or learnt.size() == 1 or chronoLevel - btlevel < chrono_backtrack) {
+        return btlevel;
+    }
+    ++chrono_backtracks;
+    for (int i = trail_lim[btlevel]; i < trail_lim[chronoLevel]; ++i) {
+        if (theory_handler.isDeclared(var(trail[i]))) {
+            ++saved_theory_assertions;
+        }
+    }
+    return chronoLevel;
+}
+
 
 // Check if 'p' can be removed. 'abstract_levels' is used to abort early if the algorithm is
 // visiting literals at levels that cannot be removed later.
@@ -851,7 +905,7 @@ bool CoreSMTSolver::litRedundant(Lit p, uint32_t abstract_levels)
             // Temporairly backtracking
             cancelUntilVarTempInit( v );
             // Retrieving the reason
-            theory_handler.getReason(p, r);
+            theory_handler.getReason(p, deductionTokens[var(p)], r);
             // Restoring trail
             cancelUntilVarTempDone( );
             CRef ct = CRef_Undef;
@@ -980,7 +1034,7 @@ void CoreSMTSolver::analyzeFinal(Lit p, vec<Lit>& out_conflict)
                 {
                     cancelUntilVarTempInit(x);
                     vec<Lit> r;
-                    theory_handler.getReason(trail[i], r);
+                    theory_handler.getReason(trail[i], deductionTokens[x], r);
                     assert(r.size() > 0);
                     assert(r[0] == trail[i]);
                     for (int j = 1; j < r.size(); j++) {
@@ -1034,7 +1088,8 @@ void CoreSMTSolver::uncheckedEnqueue(Lit p, CRef from)
   |
   |  Description:
   |    Propagates all enqueued facts. If a conflict arises, the conflicting clause is returned,
-  |    otherwise NULL.
+  |    otherwise NULL.  The binary clauses of a literal are propagated before its longer clauses;
+  |    their watchers hold the other literal, so the clause is only accessed when it implies it.
   |
   |    Post-conditions:
   |      * the propagation queue is empty, even if there was a conflict.
@@ -1044,16 +1099,56 @@ CRef CoreSMTSolver::propagate()
     CRef    confl     = CRef_Undef;
     int     num_props = 0;
     watches.cleanAll();
+    watchesBin.cleanAll();
 
     while (qhead < trail.size())
     {
         Lit            p   = trail[qhead++];     // 'p' is enqueued fact to propagate.
+        num_props++;
+        if (assertTheoryInPropagation and theory_handler.isDeclared(var(p)) and not theory_handler.assertLits(trail)) {
+            theoryConflictInPropagation = true;
+            qhead = trail.size();
+            break;
+        }
+
+        vec<Watcher> const & wbin = watchesBin[p];
+        for (int k = 0; k < wbin.size(); k++)
+        {
+            Lit other = wbin[k].blocker;
+            if (value(other) == l_True)
+                continue;
+
+            CRef cr = wbin[k].cref;
+            if (value(other) == l_False) // clause is falsified
+            {
+                confl = cr;
+                qhead = trail.size();
+                if (decisionLevel() == 0 && this->logsProofForInterpolation()) {
+                    this->finalizeProof(confl);
+                }
+                break;
+            }
+            // The implied literal must be the first one of its reason
+            Clause& c = ca[cr];
+            if (c[0] != other)
+                c[1] = c[0], c[0] = other;
+            if (decisionLevel() == 0 && this->logsProofForInterpolation()) {
+                cr = logLevelZeroPropagation(cr);
+            }
+            uncheckedEnqueue(other, cr);
+        }
+        if (confl != CRef_Undef)
+            break;
+
         vec<Watcher>&  ws  = watches[p];
         Watcher        *i, *j, *end;
-        num_props++;
 
         for (i = j = (Watcher*)ws, end = i + ws.size();  i != end;)
         {
+            // The clause of the next watcher is likely to be inspected; have it on the way while this one is handled
+            if (i + 1 != end) {
+                ca.prefetch(i[1].cref);
+            }
             // Try to avoid inspecting the clause:
             Lit blocker = i->blocker;
             if (value(blocker) == l_True)
@@ -1107,21 +1202,7 @@ CRef CoreSMTSolver::propagate()
             }
             else {  // clause is unit under assignment:
                 if (decisionLevel() == 0 && this->logsProofForInterpolation()) {
-                    // MB: we need to log the derivation of the unit clauses at level 0, otherwise the proof
-                    //     is not constructed correctly
-                    proof->beginChain(cr);
-                    for (unsigned k = 1; k < c.size(); k++)
-                    {
-                        assert(level(var(c[k])) == 0);
-                        assert(reason(var(c[k])) != CRef_Fake);
-                        assert(reason(var(c[k])) != CRef_Undef);
-                        proof->addResolutionStep(reason(var(c[k])), var(c[k]));
-                    }
-                    CRef unitClause = ca.alloc(vec<Lit>{first});
-                    proof->endChain(unitClause);
-                    // Replace the reason for enqueing the literal with the unit clause.
-                    // Necessary for correct functioning of proof logging in analyze()
-                    cr = unitClause;
+                    cr = logLevelZeroPropagation(cr);
                 }
                 uncheckedEnqueue(first, cr);
             }
@@ -1137,6 +1218,27 @@ NextClause:
     return confl;
 }
 
+CRef CoreSMTSolver::logLevelZeroPropagation(CRef cr)
+{
+    // MB: we need to log the derivation of the unit clauses at level 0, otherwise the proof
+    //     is not constructed correctly
+    proof->beginChain(cr);
+    Clause const & c = ca[cr];
+    Lit first = c[0];
+    for (unsigned k = 1; k < c.size(); k++)
+    {
+        assert(level(var(c[k])) == 0);
+        assert(reason(var(c[k])) != CRef_Fake);
+        assert(reason(var(c[k])) != CRef_Undef);
+        proof->addResolutionStep(reason(var(c[k])), var(c[k]));
+    }
+    CRef unitClause = ca.alloc(vec<Lit>{first});
+    proof->endChain(unitClause);
+    // Replace the reason for enqueing the literal with the unit clause.
+    // Necessary for correct functioning of proof logging in analyze()
+    return unitClause;
+}
+
 
 /*_________________________________________________________________________________________________
   |
@@ -1178,9 +1280,67 @@ void CoreSMTSolver::reduceDB()
     }
     learnts.shrink(i - j);
     checkGarbage();
+    removeDeletedProofLeaves();
+}
+
+/*_________________________________________________________________________________________________
+  |
+  |  reduceDBTiered : ()  ->  [void]
+  |
+  |  Description:
+  |    Remove learnt clauses by the tiers of their glue.  Binary clauses, core clauses and clauses used
+  |    since the previous reduction are kept.  The rest are ordered by decreasing glue and increasing
+  |    activity, and the first half of them is removed, minus the locked clauses.
+  |________________________________________________________________________________________________@*/
+struct reduceDBTiered_lt
+{
+    ClauseAllocator& ca;
+    reduceDBTiered_lt(ClauseAllocator& ca_) : ca(ca_) {}
+    bool operator () (CRef x, CRef y)
+    {
+        Clause& cx = ca[x];
+        Clause& cy = ca[y];
+        return cx.getGlue() > cy.getGlue() || (cx.getGlue() == cy.getGlue() && cx.activity() < cy.activity());
+    }
+};
+void CoreSMTSolver::reduceDBTiered()
+{
+    int i, j;
+    vec<CRef> candidates;
+    for (i = j = 0; i < learnts.size(); i++)
+    {
+        Clause& c = ca[learnts[i]];
+        bool keep = c.size() == 2 or c.getGlue() <= coreGlue or c.used();
+        c.setUsed(false);
+        if (keep) {
+            learnts[j++] = learnts[i];
+        } else {
+            candidates.push(learnts[i]);
+        }
+    }
+    learnts.shrink(i - j);
+    sort(candidates, reduceDBTiered_lt(ca));
+    for (i = 0; i < candidates.size(); i++)
+    {
+        Clause& c = ca[candidates[i]];
+        if (i < candidates.size() / 2 and not locked(c)) {
+            removeClause(candidates[i]);
+            ++removed_learnts;
+        } else {
+            learnts.push(candidates[i]);
+        }
+    }
+    ++db_reductions;
+    checkGarbage();
+    removeDeletedProofLeaves();
+}
+
+void CoreSMTSolver::removeDeletedProofLeaves()
+{
     if (logsProofForInterpolation()) {
         // Remove unused leaves
         // FIXME deal with theory lemmata when proofs will be extended to theories
+        int i, j;
         for (i = j = 0; i < pleaves.size(); i++) {
             CRef cr = pleaves[i];
             assert(ca[cr].mark() == 1);
@@ -1214,6 +1374,204 @@ void CoreSMTSolver::rebuildOrderHeap()
     order_heap.build(vs);
 }
 
+/*_________________________________________________________________________________________________
+  |
+  |  inprocess : [void]  ->  [bool]
+  |
+  |  Description:
+  |    Vivifies the learnt clauses, including the learnt theory lemmas, that have not been vivified
+  |    yet.  Must be called at level 0 after a restart.  Only Boolean propagation is used, so the
+  |    theory solvers are not involved, and no variable is eliminated, so the frozen theory atoms are
+  |    left as they are.  Returns false if a unit derived by vivification makes the problem unsat.
+  |________________________________________________________________________________________________@*/
+bool CoreSMTSolver::inprocess()
+{
+    assert(decisionLevel() == 0);
+    assert(not logsProofForInterpolation());
+    uint64_t const budget = propagations + static_cast<uint64_t>((propagations - inprocessPropagations) * inprocessPropagationRatio);
+
+    vec<CRef> candidates;
+    for (CRef cr : learnts) {
+        Clause const & c = ca[cr];
+        if (c.mark() == 0 and not c.vivified() and c.size() > 2 and not locked(c)) {
+            candidates.push(cr);
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), [this](CRef x, CRef y) {
+        return ca[x].getGlue() < ca[y].getGlue();
+    });
+    bool ok_ = true;
+    for (CRef cr : candidates) {
+        if (propagations >= budget) {
+            break;
+        }
+        if (ca[cr].mark() != 0) {
+            continue; // Removed as a satisfied clause by an earlier unit
+        }
+        if (not vivifyClause(cr)) {
+            ok_ = false;
+            break;
+        }
+    }
+
+    int i, j;
+    for (i = j = 0; i < learnts.size(); i++) {
+        if (ca[learnts[i]].mark() == 0) {
+            learnts[j++] = learnts[i];
+        }
+    }
+    learnts.shrink(i - j);
+    inprocessPropagations = propagations;
+    checkGarbage();
+    return ok_;
+}
+
+// Propagates the negations of the literals of the learnt clause cr one by one.  A conflict, or a literal of the
+// clause becoming true, shows that the clause follows from the literals propagated so far, and only those that the
+// conflict depends on are kept.  If the conflicting clause itself consists of such literals, it subsumes cr and cr is
+// removed.
+bool CoreSMTSolver::vivifyClause(CRef cr)
+{
+    Clause & c = ca[cr];
+    vivify_lits.clear();
+    for (Lit l : c) {
+        if (value(l) == l_True) {
+            removeClause(cr);
+            return true;
+        }
+        if (value(l) == l_Undef) {
+            vivify_lits.push(l);
+        }
+    }
+    detachClause(cr, true);
+
+    CRef confl = CRef_Undef;
+    Lit implied = lit_Undef;
+    for (Lit l : vivify_lits) {
+        if (value(l) == l_True) {
+            implied = l;
+            break;
+        }
+        if (value(l) == l_False) {
+            continue;
+        }
+        newDecisionLevel();
+        uncheckedEnqueue(~l);
+        confl = propagate();
+        if (confl != CRef_Undef) {
+            break;
+        }
+    }
+
+    bool subsumed = false;
+    vivify_kept.clear();
+    if (confl != CRef_Undef or implied != lit_Undef) {
+        CRef start = confl != CRef_Undef ? confl : reason(var(implied));
+        subsumed = vivifyAnalyze(start, implied, vivify_kept);
+        if (implied != lit_Undef) {
+            vivify_kept.push(implied);
+        }
+        if (subsumed and ca[start].learnt()) {
+            // The subsuming learnt clause takes over the role of the removed one
+            Clause & subsumer = ca[start];
+            subsumer.setGlue(std::min(subsumer.getGlue(), ca[cr].getGlue()));
+            subsumer.setUsed(true);
+        }
+    } else {
+        // The literals that became false are implied by the others and can be dropped
+        for (Lit l : vivify_lits) {
+            if (level(var(l)) == 0 or reason(var(l)) == CRef_Undef) {
+                vivify_kept.push(l);
+            }
+        }
+    }
+    cancelVivification();
+
+    Clause & d = ca[cr];
+    if (subsumed) {
+        // Already detached
+        ++subsumed_learnts;
+        d.mark(1);
+        ca.free(cr);
+        return true;
+    }
+    d.setVivified(true);
+    if (vivify_kept.size() == static_cast<int>(d.size())) {
+        attachClause(cr);
+        return true;
+    }
+    ++vivified_learnts;
+    vivified_literals += d.size() - vivify_kept.size();
+    for (int k = 0; k < vivify_kept.size(); k++) {
+        d[k] = vivify_kept[k];
+    }
+    d.shrink(d.size() - vivify_kept.size());
+    d.setGlue(std::min<uint32_t>(d.getGlue(), d.size()));
+    if (d.size() > 1) {
+        attachClause(cr);
+        return true;
+    }
+    // A new unit
+    Lit unit = d[0];
+    d.mark(1);
+    ca.free(cr);
+    uncheckedEnqueue(unit);
+    return propagate() == CRef_Undef;
+}
+
+// Collects to kept the clause literals whose negations, decided by vivification, the clause start depends on.
+// Returns true if start consists of such literals only, besides the implied literal.
+bool CoreSMTSolver::vivifyAnalyze(CRef start, Lit implied, vec<Lit> & kept)
+{
+    bool onlyDecisions = true;
+    for (Lit l : ca[start]) {
+        Var x = var(l);
+        if (l == implied) {
+            continue;
+        }
+        if (level(x) == 0) {
+            onlyDecisions = false;
+            continue;
+        }
+        if (reason(x) != CRef_Undef) {
+            onlyDecisions = false;
+        }
+        seen[x] = 1;
+    }
+    for (int i = trail.size() - 1; i >= trail_lim[0]; i--) {
+        Var x = var(trail[i]);
+        if (not seen[x]) {
+            continue;
+        }
+        seen[x] = 0;
+        if (reason(x) == CRef_Undef) {
+            kept.push(~trail[i]);
+            continue;
+        }
+        for (Lit l : ca[reason(x)]) {
+            if (var(l) != x and level(var(l)) > 0) {
+                seen[var(l)] = 1;
+            }
+        }
+    }
+    return onlyDecisions;
+}
+
+void CoreSMTSolver::cancelVivification()
+{
+    if (decisionLevel() == 0) {
+        return;
+    }
+    for (int c = trail.size() - 1; c >= trail_lim[0]; c--) {
+        Var x = var(trail[c]);
+        assigns[x] = l_Undef;
+        insertVarOrder(x);
+    }
+    qhead = trail_lim[0];
+    trail.shrink(trail.size() - trail_lim[0]);
+    trail_lim.clear();
+}
+
 
 /*_________________________________________________________________________________________________
   |
@@ -1303,8 +1661,11 @@ void CoreSMTSolver::popBacktrackPoint()
             activity    .pop();
             vardata     .pop();
             assigns     .pop();
+            deductionTokens.pop();
             watches.clean(mkLit(x, true));
             watches.clean(mkLit(x, false));
+            watchesBin.clean(mkLit(x, true));
+            watchesBin.clean(mkLit(x, false));
             // Remove variable from translation tables
 //      theory_handler->clearVar( x );
         }
@@ -1402,6 +1763,7 @@ lbool CoreSMTSolver::search(int nof_conflicts)
     vec<Lit>    learnt_clause;
 
     starts++;
+    targetTrail = 0;
 
 #ifdef STATISTICS
     const double start = cpuTime( );
@@ -1431,6 +1793,17 @@ lbool CoreSMTSolver::search(int nof_conflicts)
         search_counter++;
         CRef confl = propagate();
         runPeriodic();
+        if (confl == CRef_Undef and theoryConflictInPropagation) {
+            // The theory conflict found during propagation is handled as one found by checkTheory
+            theoryConflictInPropagation = false;
+            propagation_theory_conflicts++;
+            conflicts++;
+            conflictC++;
+            if (handleUnsat() == TPropRes::Unsat) {
+                return zeroLevelConflictHandler();
+            }
+            continue;
+        }
         if (confl != CRef_Undef) {
             if (conflicts > conflictsUntilFlip) {
                 flipState = not flipState;
@@ -1451,10 +1824,16 @@ lbool CoreSMTSolver::search(int nof_conflicts)
             if (decisionLevel() == 0) {
                 return zeroLevelConflictHandler();
             }
+            if (stableMode and target_phase) {
+                updateTargetPhase();
+            }
+            if (conflicts >= nextRephase) {
+                rephase();
+            }
             learnt_clause.clear();
             analyze(confl, learnt_clause, backtrack_level);
 
-            cancelUntil(backtrack_level);
+            cancelUntil(conflictBacktrackLevel(learnt_clause, backtrack_level));
 
             assert(value(learnt_clause[0]) == l_Undef);
 
@@ -1488,7 +1867,7 @@ lbool CoreSMTSolver::search(int nof_conflicts)
             learntSizeAdjust();
         } else {
             // NO CONFLICT
-            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || !withinBudget()) {
+            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || conflicts >= nextModeSwitch || !withinBudget()) {
                 // Reached bound on number of conflicts:
                 progress_estimate = progressEstimate();
                 cancelUntil(0);
@@ -1502,7 +1881,13 @@ lbool CoreSMTSolver::search(int nof_conflicts)
             // Two ways of reducing the clause.  The latter one seems to be working
             // better (not running proper tests since the cluster is down...)
             // if ((learnts.size()-nAssigns()) >= max_learnts)
-            if (nof_learnts >= 0 and learnts.size() >= nof_learnts) {
+            if (reduce_db == sat_reduce_db_tiered) {
+                if (conflicts >= nextReduceConflicts) {
+                    reduceDBTiered();
+                    reduceInterval += reduceIntervalIncrement;
+                    nextReduceConflicts = conflicts + reduceInterval;
+                }
+            } else if (nof_learnts >= 0 and learnts.size() >= nof_learnts) {
                 // Reduce the set of learnt clauses:
                 reduceDB();
                 nof_learnts *= nofLearntsIncrement;
@@ -1734,6 +2119,16 @@ lbool CoreSMTSolver::solve_()
     }
     double next_printout = restart_first;
 
+    // Every query starts in the stable mode
+    if (not stableMode) {
+        switchSearchMode();
+    }
+    nextModeSwitch = search_mode == sat_search_mode_alternate ? conflicts + mode_switch_conflicts : UINT64_MAX;
+    if (search_mode == sat_search_mode_focused) {
+        switchSearchMode();
+    }
+    nextRephase = rephase_interval > 0 ? conflicts + rephase_interval : UINT64_MAX;
+
     // Search:
 
     if (config.dryrun())
@@ -1757,8 +2152,21 @@ lbool CoreSMTSolver::solve_()
         }
 
         // XXX
+        assertTheoryInPropagation = eager_theory_assertion;
         status = search((int)nof_conflicts);
+        assertTheoryInPropagation = false;
         nof_conflicts = restartNextLimit(nof_conflicts);
+        if (status == l_Undef and inprocess_learnts and conflicts >= nextInprocess and decisionLevel() == 0
+            and not logsProofForInterpolation()) {
+            if (not inprocess()) {
+                status = zeroLevelConflictHandler();
+            }
+            nextInprocess = conflicts + inprocessInterval;
+        }
+        if (conflicts >= nextModeSwitch) {
+            switchSearchMode();
+            nextModeSwitch = conflicts + (mode_switches + 1) * static_cast<uint64_t>(mode_switch_conflicts);
+        }
     }
 
     if (status == l_True) {
@@ -1783,6 +2191,49 @@ void CoreSMTSolver::clearSearch()
 //    }
 }
 
+// Switches between the stable and the focused mode
+void CoreSMTSolver::switchSearchMode()
+{
+    stableMode = not stableMode;
+    var_decay = stableMode ? stable_var_decay : focusedVarDecay;
+    ++mode_switches;
+}
+
+// Records the polarities of the conflict-free part of the trail if it is the longest since the last restart.
+// Called at a conflict, when the assignment below the current decision level is conflict-free.
+void CoreSMTSolver::updateTargetPhase()
+{
+    assert(decisionLevel() > 0);
+    int const conflictFree = trail_lim.last();
+    if (conflictFree <= targetTrail) {
+        return;
+    }
+    for (int i = 0; i < conflictFree; i++) {
+        targetPolarity[var(trail[i])] = sign(trail[i]) ? l_False : l_True;
+    }
+    targetTrail = conflictFree;
+}
+
+// Resets the phases, alternately to the best phases and to the initial phases.  The interval to the next rephasing
+// grows arithmetically.
+void CoreSMTSolver::rephase()
+{
+    ++rephases;
+    if (rephases % 2 == 1) {
+        for (int v = 0; v < nVars(); v++) {
+            targetPolarity[v] = savedPolarity[v] ? l_True : l_False;
+        }
+    } else {
+        for (int v = 0; v < nVars(); v++) {
+            savedPolarity[v] = true;
+            targetPolarity[v] = l_Undef;
+        }
+    }
+    longestTrail = 0;
+    targetTrail = 0;
+    nextRephase = conflicts + (rephases + 1) * static_cast<uint64_t>(rephase_interval);
+}
+
 lbool CoreSMTSolver::zeroLevelConflictHandler() {
     ok = false;
     return l_False;
@@ -1798,6 +2249,7 @@ void CoreSMTSolver::relocAll(ClauseAllocator& to)
     //
     // for (int i = 0; i < watches.size(); i++)
     watches.cleanAll();
+    watchesBin.cleanAll();
     for (int v = 0; v < nVars(); v++)
         for (int s = 0; s < 2; s++)
         {
@@ -1806,6 +2258,9 @@ void CoreSMTSolver::relocAll(ClauseAllocator& to)
             vec<Watcher>& ws = watches[p];
             for (int j = 0; j < ws.size(); j++)
                 ca.reloc(ws[j].cref, to);
+            vec<Watcher>& wbin = watchesBin[p];
+            for (int j = 0; j < wbin.size(); j++)
+                ca.reloc(wbin[j].cref, to);
         }
 
     // All reasons:
@@ -1868,7 +2323,7 @@ int CoreSMTSolver::restartNextLimit ( int nof_conflicts )
         else
             luby_previous.push_back( luby_previous[luby_i - (1 << (luby_k - 1))]);
 
-        return luby_previous.back() * lubyFactor;
+        return luby_previous.back() * (stableMode ? lubyFactor : focusedLubyFactor);
     }
     // Standard restart
     return nof_conflicts * restart_inc;
@@ -1892,6 +2347,13 @@ void CoreSMTSolver::printStatistics( ostream & os )
     os << "; Conflicts learnt.........: " << conflicts << endl;
     os << "; T-conflicts learnt.......: " << learnt_theory_conflicts << endl;
     os << "; Average learnts size.....: " << learnts_size/conflicts << endl;
+    os << "; Learnt DB reductions.....: " << db_reductions << " (" << removed_learnts << " clauses removed)" << endl;
+    os << "; Chronological backtracks.: " << chrono_backtracks << " (" << saved_theory_assertions << " theory literals kept)" << endl;
+    os << "; Conflicts in propagation.: " << propagation_theory_conflicts << endl;
+    os << "; Search mode switches.....: " << mode_switches << endl;
+    os << "; Rephasings...............: " << rephases << endl;
+    os << "; Vivified learnts.........: " << vivified_learnts << " (" << vivified_literals << " literals removed, "
+       << subsumed_learnts << " subsumed)" << endl;
     os << "; Top level literals.......: " << top_level_lits << endl;
     os << "; Search time..............: " << search_timer.getTime() << " s" << endl;
     if ( config.sat_preprocess_booleans != 0
@@ -207,6 +207,15 @@ public:
     double    learntsize_factor;  // The intitial limit for learnt clauses is a factor of the original clauses.                (default 1 / 3)
     double    learntsize_inc;     // The limit for learnt clauses is multiplied with this factor each restart.                 (default 1.1)
     bool      expensive_ccmin;    // Controls conflict clause minimization.                                                    (default TRUE)
+    SatReduceDB reduce_db;        // Controls the removal of learnt clauses (activity or tiered by glue).                      (default tiered)
+    int       chrono_backtrack;   // Backjumps over more levels than this undo only the conflicting level (0=always backjump). (default 100)
+    SatSearchMode search_mode;    // Stable, focused, or alternating search.                                                   (default stable)
+    int       mode_switch_conflicts; // Conflicts of the first mode when alternating; later modes get this many more each. (default 1000)
+    bool      target_phase;       // Decide by the target phases in the stable mode.                                           (default false)
+    int       rephase_interval;   // The initial number of conflicts between rephasings (0=never rephase).                     (default 0)
+    bool      inprocess_learnts;  // Vivify the learnt clauses between restarts.                                               (default true)
+    bool      eager_theory_assertion; // Assert each propagated theory literal to the theory solvers during unit propagation. (default false)
+    double    stable_var_decay;   // The variable activity decay of the stable mode; 'var_decay' is the one in use.
 
     int       learntsize_adjust_start_confl;
     double    learntsize_adjust_inc;
@@ -223,6 +232,9 @@ public:
     uint64_t all_learnts;
     uint64_t learnt_theory_conflicts;
     uint64_t top_level_lits;
+    uint64_t chrono_backtracks;
+    uint64_t saved_theory_assertions; // Theory literals kept on the trail by chronological backtracking
+    uint64_t propagation_theory_conflicts; // Theory conflicts found by eager assertion during unit propagation
 
 
 protected:
@@ -313,12 +325,16 @@ protected:
     vec<double>         activity;         // A heuristic measurement of the activity of a variable.
     double              var_inc;          // Amount to bump next variable with.
     OccLists<Lit, vec<Watcher>, WatcherDeleted>  watches;          // 'watches[lit]' is a list of constraints watching 'lit' (will go there if literal becomes true).
+    OccLists<Lit, vec<Watcher>, WatcherDeleted>  watchesBin;       // Like 'watches' but for binary clauses only; the blocker is the other literal of the clause.
     vec<lbool>          assigns;          // The current assignments (lbool:s stored as char:s).
-    vec<bool>           savedPolarity;
+    vec<bool>           savedPolarity;    // The polarities of the longest trail since the last rephasing.
     int                 longestTrail = 0;
+    vec<lbool>          targetPolarity;   // The polarities of the longest conflict-free trail since the last restart.
+    int                 targetTrail = 0;
     uint64_t            conflictsUntilFlip = 0;
     uint64_t            flipIncrement = 10000;
     bool                flipState = false;
+    vec<DeductionToken> deductionTokens;  // For the variables propagated by the theory, the deduction to build the reason from.
     vec<bool>           var_seen;
     vec<char>           decision;         // Declares if a variable is eligible for selection in the decision heuristic.
 protected:
@@ -368,6 +384,7 @@ protected:
     void     insertVarOrder   (Var x);                                                 // Insert a variable in the decision order priority queue.
     Var doRandomDecision();
     Lit choosePolarity(Var next);
+    bool savedSign(Var v) const; // The sign of v by its target or saved phase
     virtual Var doActivityDecision();
     virtual bool branchLitRandom();
     virtual Lit  pickBranchLit ();                                                     // Return the next decision variable.
@@ -375,8 +392,14 @@ protected:
     void     uncheckedEnqueue (Lit p, CRef from = CRef_Undef);                         // Enqueue a literal. Assumes value of literal is undefined.
     bool     enqueue          (Lit p, CRef from = CRef_Undef);                         // Test if fact 'p' contradicts current state, enqueue otherwise.
     CRef     propagate        ();                                                      // Perform unit propagation. Returns possibly conflicting clause.
+    // With eager theory assertion, propagation asserts the propagated theory literals during the search and stops at a
+    // theory conflict, which is then left for handleUnsat.
+    bool     assertTheoryInPropagation = false;
+    bool     theoryConflictInPropagation = false;
+    CRef     logLevelZeroPropagation(CRef cr);                                         // Log the derivation of the unit implied by 'cr' at level 0, return the unit clause.
     virtual void cancelUntil  (int level);                                             // Backtrack until a certain level.
     void     analyze          (CRef confl, vec<Lit>& out_learnt, int& out_btlevel);    // (bt = backtrack)
+    int      conflictBacktrackLevel(vec<Lit> const & learnt, int btlevel);             // The level to backtrack to after learning 'learnt'
     template<class T>
     uint32_t computeGlue(T const & ps);
     nat_set  levelsInClause;
@@ -385,11 +408,53 @@ protected:
     lbool    search           (int nof_conflicts);                    // Search for a given number of conflicts.
     int nof_learnts = 40000;
     double nofLearntsIncrement = 1.1;
+    // Tiered reduction of the learnt clauses: the core clauses (glue at most coreGlue) are kept forever, the other
+    // clauses are kept while they are used in conflict analysis between two reductions.  Of the unused ones, the half
+    // with the highest glue and lowest activity is removed.  Reductions happen every reduceInterval conflicts; the
+    // interval grows with each reduction.
+    static constexpr uint32_t coreGlue = 2;
+    static constexpr uint64_t firstReduceInterval = 2000;
+    static constexpr uint64_t reduceIntervalIncrement = 300;
+    uint64_t reduceInterval = firstReduceInterval;
+    uint64_t nextReduceConflicts = firstReduceInterval;
+    uint64_t db_reductions = 0;
+    uint64_t removed_learnts = 0;
+    // Search modes: the stable mode restarts rarely and follows the target phases, the focused mode restarts often
+    // and decays the variable activities fast so that the decisions follow the most recent conflicts.
+    static constexpr unsigned focusedLubyFactor = 20;
+    static constexpr double focusedVarDecay = 1 / 0.75;
+    bool     stableMode = true;
+    uint64_t nextModeSwitch = UINT64_MAX;
+    uint64_t mode_switches = 0;
+    void     switchSearchMode ();
+    // Rephasing: every so often the saved and target phases are reset to the best phases or to the initial ones
+    uint64_t nextRephase = UINT64_MAX;
+    uint64_t rephases = 0;
+    void     rephase          ();
+    void     updateTargetPhase();
+    // Inprocessing: between restarts, the learnt clauses not vivified yet are vivified, the ones with the lowest glue
+    // first.  A round stops when its propagations exceed inprocessPropagationRatio of the propagations of the search
+    // since the previous round.
+    static constexpr uint64_t inprocessInterval = 2000;
+    static constexpr double inprocessPropagationRatio = 0.1;
+    uint64_t nextInprocess = inprocessInterval;
+    uint64_t inprocessPropagations = 0;
+    uint64_t vivified_learnts = 0;
+    uint64_t vivified_literals = 0;
+    uint64_t subsumed_learnts = 0;
+    vec<Lit> vivify_lits;
+    vec<Lit> vivify_kept;
+    bool     inprocess        ();                                                      // Vivify the learnt clauses; false if unsat.
+    bool     vivifyClause     (CRef cr);                                               // Vivify a learnt clause; false if unsat.
+    bool     vivifyAnalyze    (CRef start, Lit implied, vec<Lit> & kept);              // Collect the clause literals a conflict depends on.
+    void     cancelVivification();                                                     // Undo the decisions of vivification.
     virtual bool okContinue   () const;                                                // Check search termination conditions
     virtual ConsistencyAction notifyConsistency() { return ConsistencyAction::NoOp; }  // Called when the search has reached a consistent point
     virtual void notifyEnd() { }                                                       // Called at the end of the search loop
     void     learntSizeAdjust ();                                                      // Adjust learnts size and print something
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
+    void     reduceDBTiered   ();                                                      // Reduce the set of learnt clauses by their glue tiers.
+    void     removeDeletedProofLeaves();
     void     removeSatisfied  (vec<CRef>& cs);                                         // Shrink 'cs' to contain only non-satisfied clauses.
     void     rebuildOrderHeap ();
     virtual lbool zeroLevelConflictHandler();                                          // Common handling of zero-level conflict as it can happen at multiple places
@@ -740,7 +805,7 @@ inline bool     CoreSMTSolver::withinBudget() const
  * IJCAI 2009.
  *
  * @param vector of literals each having a level in vardata
- * @return min (4, |{level(var(lit))}| \mid lit \in ps)
+ * @return min (7, |{level(var(lit))}| \mid lit \in ps), where 7 is the largest glue stored in a clause
  */
 template<class T>
 uint32_t CoreSMTSolver::computeGlue(T const & ps) {
@@ -751,7 +816,7 @@ uint32_t CoreSMTSolver::computeGlue(T const & ps) {
         if (level != 0 and not levelsInClause.contains(level)) {
             levelsInClause.insert(level);
             ++ numLevels;
-            if (numLevels >= 4) {
+            if (numLevels >= 7) {
                 break;
             }
         }
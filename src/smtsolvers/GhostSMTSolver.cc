@@ -132,7 +132,7 @@ GhostSMTSolver::pickBranchPolarity(Var next) {
     }
 
     if (not signSet) {
-        sign = (savedPolarity[next] == flipState);
+        sign = savedSign(next);
     }
 
     Lit l = mkLit(next, sign);
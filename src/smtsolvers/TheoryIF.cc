@@ -221,7 +221,7 @@ CoreSMTSolver::handleSat()
         CRef deducedReason = CRef_Fake;
         if (decisionLevel() == 0 and logsProofForInterpolation()) {
             vec<Lit> reasonLits;
-            theory_handler.getReason(l, reasonLits);
+            theory_handler.getReason(l, deductionTokens[var(l)], reasonLits);
             assert(reasonLits.size() > 0);
             CRef theoryReason = ca.alloc(reasonLits);
             CRef unit = ca.alloc(vec<Lit>{l});
@@ -320,7 +320,7 @@ CoreSMTSolver::handleUnsat()
         }
     }
 
-    cancelUntil(backtrack_level);
+    cancelUntil(conflictBacktrackLevel(learnt_clause, backtrack_level));
     assert(value(learnt_clause[0]) == l_Undef);
 
     if (learnt_clause.size() == 1) {
@@ -404,14 +404,16 @@ TPropRes CoreSMTSolver::checkTheory(bool complete, int& conflictC)
 void CoreSMTSolver::deduceTheory(vec<LitLev>& deductions)
 {
     Lit ded = lit_Undef;
+    DeductionToken token = DeductionToken_Undef;
 
     while (true)
     {
-        ded = theory_handler.getDeduction();
+        ded = theory_handler.getDeduction(token);
         if (ded == lit_Undef)      break;
         if (value(ded) != l_Undef) continue;
 
-        // Found an unassigned deduction
+        // Found an unassigned deduction; only its token is kept for building the reason if needed
+        deductionTokens[var(ded)] = token;
         deductions.push(LitLev(ded, decisionLevel()));
     }
 #ifdef PEDANTIC_DEBUG
@@ -165,12 +165,16 @@ THandler::getInterpolant(const ipartitions_t& mask, std::map<PTRef, icolor_t> *l
 // appearing only in clauses that are tautological.  We check this here, but it
 // would be better to remove them from egraph after simplifications are done.
 //
-Lit THandler::getDeduction() {
+Lit THandler::getDeduction(DeductionToken & token) {
     PtAsgn_reason e = PtAsgn_reason_Undef;
+    vec<TSolver*> const & solverSchedule = getSolverHandler().solverSchedule;
     while (true) {
-        for (auto solver : getSolverHandler().solverSchedule) {
-            e = solver->getDeduction();
-            if (e.tr != PTRef_Undef) break;
+        for (int i = 0; i < solverSchedule.size(); i++) {
+            e = solverSchedule[i]->getDeduction();
+            if (e.tr != PTRef_Undef) {
+                token = {static_cast<uint32_t>(i), static_cast<uint32_t>(solverSchedule[i]->lastDeductionIndex())};
+                break;
+            }
         }
         if ( e.tr == PTRef_Undef ) {
             return lit_Undef;
@@ -200,18 +204,18 @@ Lit THandler::getSuggestion( ) {
     return tmap.getLit(e);
 }
 
-void THandler::getReason( Lit l, vec< Lit > & reason)
+void THandler::getReason(Lit l, DeductionToken token, vec<Lit> & reason)
 {
     Var   v = var(l);
     PTRef e = tmap.varToPTRef(v);
 
     // It must be a TAtom and already deduced
     assert(getLogic().isTheoryTerm(e));
-    TSolver* solver = getSolverHandler().getReasoningSolverFor(e);
-    assert(solver);
+    assert(token.solver < static_cast<uint32_t>(getSolverHandler().solverSchedule.size()));
+    TSolver* solver = getSolverHandler().solverSchedule[token.solver];
 
     // Get Explanation
-    vec<PtAsgn> explanation = solver->getReasonFor(PtAsgn(e, sign(l) ? l_False : l_True));
+    vec<PtAsgn> explanation = solver->explainDeduction(PtAsgn(e, sign(l) ? l_False : l_True), token.index);
     assert(explanation.size() > 0);
 
     // Reserve room for implied lit
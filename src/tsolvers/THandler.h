@@ -33,6 +33,15 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 class ModelBuilder;
 
+// Identifies a theory deduction by the position of the deducing solver in the solver schedule and the index of the
+// deduction among the deductions of that solver.  The explanation of the deduction is built from it only when needed.
+struct DeductionToken {
+    uint32_t solver;
+    uint32_t index;
+};
+
+static constexpr DeductionToken DeductionToken_Undef = {UINT32_MAX, UINT32_MAX};
+
 class THandler
 {
 private:
@@ -66,9 +75,9 @@ public:
     std::vector<vec<Lit>> getNewSplits(); // Return the new splits as a vector of literals that needs to be interpreted as a clause.
 
     PTRef   getInterpolant       (const ipartitions_t&, std::map<PTRef, icolor_t>*, PartitionManager &pmanager);
-    Lit     getDeduction         ();                      // Returns a literal that is implied by the current state and the reason literal
+    Lit     getDeduction         (DeductionToken &);      // Returns a literal that is implied by the current state and its deduction token
     Lit     getSuggestion        ( );                     // Returns a literal that is suggested by the current state
-    void    getReason            ( Lit, vec< Lit > &);    // Returns the explanation for a deduced literal
+    void    getReason            (Lit, DeductionToken, vec<Lit> &); // Returns the explanation for a deduced literal
 
     void fillTheoryFunctions  (ModelBuilder & modelBuilder) const;
     PTRef   varToTerm          ( Var v ) const;//{ return tmap.varToPTRef(v); }  // Return the term ref corresponding to a variable
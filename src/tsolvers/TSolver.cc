@@ -93,6 +93,14 @@ vec<PtAsgn> TSolver::getReasonFor(PtAsgn lit) {
     return conflict;
 }
 
+vec<PtAsgn> TSolver::explainDeduction(PtAsgn lit, std::size_t) {
+    return getReasonFor(lit);
+}
+
+bool TSolver::isDeduction(PtAsgn lit, std::size_t index) const {
+    return index < th_deductions.size_() and th_deductions[index].tr == lit.tr and th_deductions[index].sgn == lit.sgn;
+}
+
 void TSolver::printStatistics(std::ostream & os) {
     os << "; -------------------------\n";
     os << "; STATISTICS FOR " << getName() << '\n';
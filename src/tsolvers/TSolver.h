@@ -144,6 +144,7 @@ protected:
         th_deductions.push(ded);
         setPolarity(ded.tr, ded.sgn);
     }
+    bool isDeduction(PtAsgn lit, std::size_t index) const; // Is lit the deduction at the given index?
 
     vec<PTRef>                  splitondemand;
 
@@ -174,9 +175,13 @@ public:
     virtual void computeModel() = 0;                      // Compute model for variables
     virtual void getConflict(vec<PtAsgn> &) = 0;          // Return conflict
     virtual vec<PtAsgn> getReasonFor(PtAsgn lit);
+    // Return the explanation of lit, the deduction at the given index of the deductions of this solver.  The solver
+    // keeps no explanations for its deductions and builds this one on demand; by default by re-deriving a conflict.
+    virtual vec<PtAsgn> explainDeduction(PtAsgn lit, std::size_t index);
     virtual bool hasNewSplits();                          // Are there new splits?
     virtual void getNewSplits(vec<PTRef>&);               // Return new splits if any
     virtual PtAsgn_reason getDeduction();                 // Return an implied literal based on the current state
+    std::size_t lastDeductionIndex() const { assert(deductions_next > 0); return deductions_next - 1; } // The index of the deduction returned last
     virtual vec<PTRef> collectEqualitiesFor(vec<PTRef> const &, std::unordered_set<PTRef, PTRefHash> const &) { return {}; }
 
     SolverId getId() { return id; }
@@ -89,14 +89,3 @@ vec<PTRef> TSolverHandler::getSplitClauses() {
     }
     return split_terms;
 }
-
-// MB: This is currently needed to replace a common array of deduced elements with solver ID
-TSolver* TSolverHandler::getReasoningSolverFor(PTRef ptref) const {
-    assert(getLogic().isTheoryTerm(ptref));
-    for (auto solver : solverSchedule) {
-        if (solver->isValid(ptref))
-            return solver;
-    }
-    assert(false);
-    return nullptr;
-}
\ No newline at end of file
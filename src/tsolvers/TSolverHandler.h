@@ -65,8 +65,5 @@ public:
     virtual lbool getPolaritySuggestion(PTRef) const { return l_Undef; }
     virtual TRes    check(bool);
     virtual vec<PTRef> getSplitClauses();
-private:
-    // Helper method for computing reasons
-    TSolver* getReasoningSolverFor(PTRef ptref) const;
 };
 #endif
@@ -52,13 +52,15 @@ class UFSolverStats
         opensmt::OSMTTimeVal egraph_backtrack_timer;
         opensmt::OSMTTimeVal egraph_explain_timer;
         int num_eq_classes;
-        UFSolverStats() : num_eq_classes(0) {}
+        uint64_t num_merges;
+        UFSolverStats() : num_eq_classes(0), num_merges(0) {}
         void printStatistics(std::ostream & os)
         {
             os << "; egraph time..............: " << egraph_asrt_timer.getTime() << " s\n";
             os << "; backtrack time...........: " << egraph_backtrack_timer.getTime() << " s\n";
             os << "; explain time.............: " << egraph_explain_timer.getTime() << " s\n";
             os << "; # eq classes at the end..: " << num_eq_classes << "\n";
+            os << "; # merges.................: " << num_merges << "\n";
         }
 };
 
@@ -275,6 +277,7 @@ public:
     PTRef      getSuggestion           ();                          // Return a suggested literal based on the current state
     lbool      getPolaritySuggestion   (PTRef);                     // Return a suggested polarity for a given literal
     void       getConflict             (vec<PtAsgn> &) override;
+    vec<PtAsgn> explainDeduction       (PtAsgn, std::size_t) override; // Explain a deduction by the merges that put it into the class of true or false
     TRes       check                   (bool) override { return TRes::SAT; }// Check satisfiability
     void       computeModel            () override;
     void       fillTheoryFunctions     (ModelBuilder & modelBuilder) const override;
@@ -283,6 +286,7 @@ public:
     vec<PTRef> collectEqualitiesFor(vec<PTRef> const & vars, std::unordered_set<PTRef, PTRefHash> const & knownEqualities) override;
 
     void       printStatistics         (std::ostream &) override;
+    UFSolverStats const & getStats     () const { return egraphStats; }
 
 #if MORE_DEDUCTIONS
   bool                deduceMore              ( vector< ERef > & );
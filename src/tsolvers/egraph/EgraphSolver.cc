@@ -189,6 +189,46 @@ void Egraph::getConflict(vec<PtAsgn> & conflict)
 #endif
 }
 
+//
+// Explain a deduction.  The deduced term is in the class of true or false, and the
+// explanation of their equality is built directly instead of asserting the negation
+// of the deduction to get a conflict
+//
+vec<PtAsgn> Egraph::explainDeduction(PtAsgn lit, std::size_t index)
+{
+    ERef term;
+    if (not isDeduction(lit, index) or not enode_store.peekERef(lit.tr, term)) {
+        return TSolver::explainDeduction(lit, index);
+    }
+    ERef constant = lit.sgn == l_True ? enode_store.getEnode_true() : enode_store.getEnode_false();
+    if (getEnode(term).getRoot() != getEnode(constant).getRoot()) {
+        return TSolver::explainDeduction(lit, index);
+    }
+    ERef x = term;
+    ERef y = constant;
+    if (lit.sgn == l_True and isEffectivelyEquality(lit.tr)) {
+        // Equal arguments have a shorter explanation than the equality term
+        Pterm const & eq = logic.getPterm(lit.tr);
+        ERef lhs = enode_store.getERef(eq[0]);
+        ERef rhs = enode_store.getERef(eq[1]);
+        if (getEnode(lhs).getRoot() == getEnode(rhs).getRoot()) {
+            x = lhs;
+            y = rhs;
+        }
+    }
+    vec<PtAsgn> reason = explainer->explain(x, y);
+    reason.push(PtAsgn(lit.tr, lit.sgn == l_True ? l_False : l_True));
+#ifdef STATISTICS
+    if (reason.size() > generalTSolverStats.max_reas_size)
+        generalTSolverStats.max_reas_size = reason.size();
+    if (reason.size() < generalTSolverStats.min_reas_size)
+        generalTSolverStats.min_reas_size = reason.size();
+    generalTSolverStats.reasons_sent ++;
+    generalTSolverStats.avg_reas_size += reason.size();
+#endif // STATISTICS
+    return reason;
+}
+
 void Egraph::clearModel()
 {
     values.reset(nullptr);
@@ -786,6 +826,7 @@ void Egraph::merge ( ERef x, ERef y, PtAsgn reason )
         std::swap(x,y);
     }
 
+    egraphStats.num_merges++;
     // MB: Before we actually merge the classes, we check if we are not merging with eq. class of constant True or False
     deduce( x, y, reason );
 
@@ -28,6 +28,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define ENODESTORE_H
 
 #include "Enode.h"
+#include "SignatureTable.h"
 #include "OsmtInternalException.h"
 
 class Logic;
@@ -71,7 +72,7 @@ class EnodeStore {
 
     Logic&         logic;
     EnodeAllocator ea;
-    Map<ERef, ERef, SignatureHash, SignatureEqual> sig_tab;
+    SignatureTable<SignatureHash, SignatureEqual> sig_tab;
     ERef           ERef_True;
     ERef           ERef_False;
     Map<PTRef,char,PTRefHash,Equal<PTRef> > dist_classes;
@@ -141,8 +142,7 @@ public:
     }
 
     inline ERef lookupSig(ERef e) const {
-        bool found = sig_tab.peek(e, e);
-        return found ? e : ERef_Undef;
+        return sig_tab.lookup(e);
     }
 
     inline void removeSig(ERef e) {
@@ -153,7 +153,7 @@ public:
 
     inline void insertSig(ERef e) {
         assert(not containsSig(e));
-        sig_tab.insert(e,e);
+        sig_tab.insert(e);
         assert(containsSig(e));
     }
 };
@@ -0,0 +1,101 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+
+#ifndef OPENSMT_SIGNATURETABLE_H
+#define OPENSMT_SIGNATURETABLE_H
+
+#include "Enode.h"
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+/*
+ * The congruence table of the egraph: a set of enodes where no two enodes have the same signature.
+ *
+ * The table uses open addressing with linear probing over a flat array. Each slot caches the hash of the signature
+ * of its enode, so most of the probed slots are rejected without looking at the enodes, and growing the table does not
+ * recompute any signature. Removal shifts the following entries of the probe sequence back instead of leaving
+ * tombstones, so the probe sequences do not degrade under the frequent removals and reinsertions of the egraph.
+ *
+ * The signature of an enode depends on the roots of its children. The caller must remove an enode from the table before
+ * the signature of the enode changes, as the cached hash would otherwise become stale.
+ */
+template<typename Hash, typename Equal>
+class SignatureTable {
+    struct Entry {
+        uint32_t hash;
+        ERef ref;
+    };
+
+    static constexpr std::size_t initialCapacity = 64;
+
+    std::vector<Entry> entries;
+    std::size_t count = 0;
+    Hash hasher;
+    Equal equal;
+
+    uint32_t mask() const { return static_cast<uint32_t>(entries.size() - 1); }
+    // Spreads the bits of the signature hash over the 32 bits of the cached hash
+    uint32_t hashOf(ERef e) const { return static_cast<uint32_t>((hasher(e) * 0x9e3779b97f4a7c15ull) >> 32); }
+
+    // The slot with a signature equal to the one of e, or the empty slot where the probe sequence of e ends
+    uint32_t find(ERef e, uint32_t hash) const {
+        for (uint32_t i = hash & mask(); ; i = (i + 1) & mask()) {
+            Entry const & entry = entries[i];
+            if (entry.ref == ERef_Undef or (entry.hash == hash and equal(entry.ref, e))) { return i; }
+        }
+    }
+
+    void grow() {
+        std::vector<Entry> old(entries.empty() ? initialCapacity : 2 * entries.size(), Entry{0, ERef_Undef});
+        old.swap(entries);
+        for (Entry const & entry : old) {
+            if (entry.ref == ERef_Undef) { continue; }
+            uint32_t i = entry.hash & mask();
+            while (entries[i].ref != ERef_Undef) { i = (i + 1) & mask(); }
+            entries[i] = entry;
+        }
+    }
+
+public:
+    SignatureTable(Hash hasher, Equal equal) : hasher(hasher), equal(equal) {}
+
+    std::size_t size() const { return count; }
+
+    // Returns the enode of the table with the same signature as e, or ERef_Undef if there is none
+    ERef lookup(ERef e) const {
+        if (count == 0) { return ERef_Undef; }
+        return entries[find(e, hashOf(e))].ref;
+    }
+
+    // Inserts e, which must not have the signature of an enode already in the table
+    void insert(ERef e) {
+        if (2 * (count + 1) > entries.size()) { grow(); }
+        uint32_t hash = hashOf(e);
+        uint32_t i = find(e, hash);
+        assert(entries[i].ref == ERef_Undef);
+        entries[i] = {hash, e};
+        ++count;
+    }
+
+    // Removes the enode with the same signature as e, which must be in the table
+    void remove(ERef e) {
+        uint32_t i = find(e, hashOf(e));
+        assert(entries[i].ref != ERef_Undef);
+        // Move back the entries whose probe sequence passes through the freed slot
+        for (uint32_t j = (i + 1) & mask(); entries[j].ref != ERef_Undef; j = (j + 1) & mask()) {
+            uint32_t home = entries[j].hash & mask();
+            bool reachable = i <= j ? (home <= i or home > j) : (home <= i and home > j);
+            if (reachable) {
+                entries[i] = entries[j];
+                i = j;
+            }
+        }
+        entries[i] = {0, ERef_Undef};
+        --count;
+    }
+};
+
+#endif //OPENSMT_SIGNATURETABLE_H
@@ -7,14 +7,74 @@
 
 #include "CutCreator.h"
 
+#include <algorithm>
+
 CutCreator::Cut CutCreator::makeCut(SparseLinearSystem && system, ColumnMapping const & columnMapping) {
+    CutStats stats;
+    auto cuts = makeCuts(std::move(system), columnMapping, CutFilter{1, 0, 0}, stats);
+    return cuts.empty() ? Cut{} : std::move(cuts[0]);
+}
+
+std::vector<CutCreator::Cut> CutCreator::makeCuts(SparseLinearSystem && system, ColumnMapping const & columnMapping,
+                                                  CutFilter const & filter, CutStats & stats) {
     auto & matrixA = system.A;
 
     assert(matrixA.colCount() == columnMapping.size());
-    uint32_t varCount = matrixA.colCount();
 
     auto [matrixU, dim] = HermiteNormalForm()(std::move(matrixA));
+    return cutsFromOperations(matrixU, dim, columnMapping, filter, stats);
+}
+
+std::vector<CutCreator::Cut> CutCreator::makeCuts(std::vector<PTRef> const & rows, std::function<RowTerms(PTRef)> const & rowTerms,
+                                                  CutFilter const & filter, CutStats & stats) {
+    uint32_t kept = 0;
+    while (kept < hnfRows.size() and kept < rows.size() and hnfRows[kept] == rows[kept]) {
+        ++kept;
+    }
+    // Undoing the operations of the removed rows should not cost more than redoing the ones of the kept rows
+    if (hnf.operationCount(hnfRows.size()) - hnf.operationCount(kept) > hnf.operationCount(kept)) {
+        kept = 0;
+    }
+    stats.rowsReused += kept;
+    stats.rowsRemoved += hnfRows.size() - kept;
+    if (kept == 0) {
+        clearCache();
+    } else {
+        hnf.removeRows(hnfRows.size() - kept);
+        hnfRows.resize(kept);
+        while (hnfColumns.size() > hnf.colCount()) {
+            hnfColumnIndices.erase(hnfColumns.back());
+            hnfColumns.pop_back();
+        }
+    }
+    SparseColMatrix::TermVec row;
+    for (uint32_t i = kept; i < rows.size(); ++i) {
+        PTRef rowKey = rows[i];
+        row.clear();
+        for (auto & [var, coeff] : rowTerms(rowKey)) {
+            auto [it, inserted] = hnfColumnIndices.insert({var, hnfColumns.size()});
+            if (inserted) {
+                hnfColumns.push_back(var);
+            }
+            row.emplace_back(IndexType{it->second}, std::move(coeff));
+        }
+        hnf.addRow(row, hnfColumns.size());
+        hnfRows.push_back(rowKey);
+        ++stats.rowsAdded;
+    }
+    return cutsFromOperations(hnf.getOperations(), hnf.getDimension(), hnfColumns, filter, stats);
+}
+
+void CutCreator::clearCache() {
+    hnf.clear();
+    hnfRows.clear();
+    hnfColumns.clear();
+    hnfColumnIndices.clear();
+}
 
+std::vector<CutCreator::Cut> CutCreator::cutsFromOperations(SparseColMatrix const & matrixU, uint32_t dim, ColumnMapping const & columnMapping,
+                                                            CutFilter const & filter, CutStats & stats) const {
+    uint32_t varCount = columnMapping.size();
     // Get the values of the variables
     std::vector<opensmt::Real> varValues;
     varValues.reserve(varCount);
@@ -24,13 +84,27 @@ CutCreator::Cut CutCreator::makeCut(SparseLinearSystem && system, ColumnMapping
     }
     // Now check every row of U for infeasibility: if the cross product of the row and vector of variable values is not
     // an integer, the row represents an infeasible constraint
-    for (uint32_t rowIndex = 0; rowIndex < dim; ++rowIndex) {
+    std::vector<Cut> cuts;
+    for (uint32_t rowIndex = 0; rowIndex < dim and cuts.size() < filter.maxCuts; ++rowIndex) {
         auto const & row = matrixU[rowIndex];
         auto product = row.product(varValues);
-        if (not product.isInteger()) {
-            return {row.toVector(), product};
+        if (product.isInteger()) { continue; }
+        ++stats.candidates;
+        if (not cuts.empty()) {
+            if (row.size() > filter.maxTerms) {
+                ++stats.tooDense;
+                continue;
+            }
+            auto termVec = row.toVector();
+            if (std::any_of(termVec.begin(), termVec.end(), [&filter](auto const & term) { return cmpabs(term.second, filter.maxCoeff) > 0; })) {
+                ++stats.tooLarge;
+                continue;
+            }
+            cuts.push_back({std::move(termVec), std::move(product)});
+            continue;
         }
+        cuts.push_back({row.toVector(), std::move(product)});
     }
-    return {};
+    return cuts;
 }
 
@@ -15,11 +15,20 @@
 #include "PTRef.h"
 #include "TypeUtils.h"
 
+#include <unordered_map>
+
 class CutCreator {
 private:
     std::function<FastRational(PTRef)> varValue;
 
     FastRational evaluate(PTRef var) const { return varValue(var); }
+
+    // The Hermite normal form kept between the calls of the cached makeCuts, with the keys of its rows in order
+    // and the variables of its columns
+    IncrementalHermiteNormalForm hnf;
+    std::vector<PTRef> hnfRows;
+    std::vector<PTRef> hnfColumns;
+    std::unordered_map<PTRef, uint32_t, PTRefHash> hnfColumnIndices;
 public:
 
 
@@ -28,6 +37,41 @@ public:
     using Cut = opensmt::pair<SparseColMatrix::TermVec, FastRational>;
     using ColumnMapping = std::vector<PTRef>;
     Cut makeCut(SparseLinearSystem && constraints, ColumnMapping const &);
+
+    // Limits on the cuts returned by makeCuts.  The first cut is the one makeCut would return; further cuts are only
+    // taken if they have at most maxTerms terms and all their coefficients are at most maxCoeff in absolute value.
+    struct CutFilter {
+        std::size_t maxCuts;
+        std::size_t maxTerms;
+        FastRational maxCoeff;
+    };
+    struct CutStats {
+        std::size_t candidates = 0; // Infeasible rows found
+        std::size_t tooDense = 0;
+        std::size_t tooLarge = 0;
+        std::size_t rowsReused = 0;  // Rows of the cached Hermite normal form that were kept
+        std::size_t rowsAdded = 0;
+        std::size_t rowsRemoved = 0;
+    };
+    // Returns up to filter.maxCuts cuts from the rows of the Hermite normal form of the constraints
+    std::vector<Cut> makeCuts(SparseLinearSystem && constraints, ColumnMapping const &, CutFilter const & filter, CutStats & stats);
+
+    // The terms (variable, coefficient) of a row of a linear system
+    using RowTerms = std::vector<std::pair<PTRef, FastRational>>;
+    /*
+     * Like makeCuts, for the linear system with the given rows; rowTerms returns the terms of a row.
+     * The Hermite normal form is kept between the calls: the rows the system shares at its beginning with the previous
+     * one are not processed again, the following ones are removed and the new ones added, unless removing them costs
+     * more than processing the shared rows again.  The cuts are the same as those of makeCuts for the system with the
+     * columns in the order of the first occurrence of the variables; the indices in the cuts refer to
+     * getColumnMapping().
+     */
+    std::vector<Cut> makeCuts(std::vector<PTRef> const & rows, std::function<RowTerms(PTRef)> const & rowTerms, CutFilter const & filter, CutStats & stats);
+    ColumnMapping const & getColumnMapping() const { return hnfColumns; }
+    void clearCache();
+
+private:
+    std::vector<Cut> cutsFromOperations(SparseColMatrix const & matrixU, uint32_t dim, ColumnMapping const &, CutFilter const & filter, CutStats & stats) const;
 };
 
 
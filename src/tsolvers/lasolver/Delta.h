@@ -106,6 +106,13 @@ public:
     Delta& operator-=(Delta const & b);
     Delta& operator-=(Delta && b);
 
+    // In-place fused updates: this += c * a and this -= c * a, without creating a temporary Delta
+    inline Delta & addScaled(const Delta & a, const Real & c);
+    inline Delta & subScaled(const Delta & a, const Real & c);
+
+    inline Delta & operator*=(const Real & c);
+    inline Delta & operator/=(const Real & c);
+
     inline friend Delta operator-(const Delta & a, const Delta & b);
 
     inline friend Delta operator+(const Delta & a, const Delta & b);
@@ -166,6 +173,30 @@ inline Delta& Delta::operator-=(Delta && b) {
     return *this;
 }
 
+Delta & Delta::addScaled(const Delta & a, const Real & c) {
+    addProductAssign(r, a.r, c);
+    addProductAssign(d, a.d, c);
+    return *this;
+}
+
+Delta & Delta::subScaled(const Delta & a, const Real & c) {
+    subProductAssign(r, a.r, c);
+    subProductAssign(d, a.d, c);
+    return *this;
+}
+
+Delta & Delta::operator*=(const Real & c) {
+    r *= c;
+    d *= c;
+    return *this;
+}
+
+Delta & Delta::operator/=(const Real & c) {
+    r /= c;
+    d /= c;
+    return *this;
+}
+
 Delta operator-(const Delta & a, const Delta & b) {
     return Delta(a.R() - b.R(), a.D() - b.D());
 }
@@ -2,6 +2,8 @@
 #include "Map.h"
 #include "Sort.h"
 
+#include <algorithm>
+
 LABound::LABound(BoundT type, LVRef var, Delta && delta, int id)
     : type(type.t)
     , bidx(UINT32_MAX)
@@ -77,21 +79,45 @@ LABoundRef LABoundStore::getBoundByIdx(LVRef v, int idx) const {
     assert(idx < var_bounds.size());
     return var_bounds[idx];
 }
+int LABoundStore::firstBoundNotBelow(LVRef v, BoundT type, Delta const & value) const {
+    auto const & refs = getBounds(v, type);
+    return std::partition_point(refs.begin(), refs.end(), [this, &value](LABoundRef br) { return ba[br].getValue() < value; }) - refs.begin();
+}
+
+int LABoundStore::firstBoundAbove(LVRef v, BoundT type, Delta const & value) const {
+    auto const & refs = getBounds(v, type);
+    return std::partition_point(refs.begin(), refs.end(), [this, &value](LABoundRef br) { return ba[br].getValue() <= value; }) - refs.begin();
+}
+
 bool LABoundStore::isUnbounded(LVRef v) const { return getBounds(v).size() == 0; }
 
 void LABoundStore::clear() {
     this->ba.clear();
     this->in_bounds.clear();
     this->bounds.clear();
+    this->lowerBounds.clear();
+    this->upperBounds.clear();
 }
 
 void LABoundStore::ensureReadyFor(LVRef v) {
     while (bounds.size() <= getVarId(v)) {
         bounds.emplace_back();
+        lowerBounds.emplace_back();
+        upperBounds.emplace_back();
+    }
+}
+
+void LABoundStore::insertOrdered(vec<LABoundRef> & refs, LABoundRef bound) {
+    refs.push(bound);
+    bound_lessthan lessthan(ba);
+    for (int idx = refs.size() - 1; idx > 0 and lessthan(refs[idx], refs[idx - 1]); --idx) {
+        std::swap(refs[idx - 1], refs[idx]);
     }
 }
 
 void LABoundStore::updateBound(BoundInfo bi) {
+    insertOrdered(upperBounds[getVarId(bi.v)], bi.ub);
+    insertOrdered(lowerBounds[getVarId(bi.v)], bi.lb);
     auto & varBounds = getBounds(bi.v);
     for (LABoundRef bound : {bi.ub, bi.lb}) {
         unsigned idx = varBounds.size();
@@ -143,6 +169,11 @@ void LABoundStore::buildBounds()
         }
 
         assert(getVarId(v) < bounds.size());
+        lowerBounds[getVarId(v)].clear();
+        upperBounds[getVarId(v)].clear();
+        for (LABoundRef ref : refs) {
+            boundsOfType(ba[ref].getType())[getVarId(v)].push(ref);
+        }
         refs.moveTo(bounds.at(getVarId(v)));
     }
 }
@@ -86,6 +86,12 @@ private:
     LABoundAllocator ba{1024};
     LAVarStore & lvstore;
     std::vector<vec<LABoundRef>> bounds;
+    // The lower and the upper bounds of each variable separately, both ordered by value as in `bounds`
+    std::vector<vec<LABoundRef>> lowerBounds;
+    std::vector<vec<LABoundRef>> upperBounds;
+    std::vector<vec<LABoundRef>> & boundsOfType(BoundT type) { return type == bound_l ? lowerBounds : upperBounds; }
+    std::vector<vec<LABoundRef>> const & boundsOfType(BoundT type) const { return type == bound_l ? lowerBounds : upperBounds; }
+    void insertOrdered(vec<LABoundRef> & refs, LABoundRef bound);
 public:
     LABoundStore(LAVarStore &lvstore) : lvstore(lvstore) {}
     void clear();
@@ -97,6 +103,11 @@ public:
     vec<LABoundRef> const & getBounds(LVRef v) const { return bounds.at(getVarId(v)); }
     vec<LABoundRef> & getBounds(LVRef v) { return bounds.at(getVarId(v)); }
     LABoundRef getBoundByIdx(LVRef v, int it) const;
+    // The bounds of v of the given type, ordered by value
+    vec<LABoundRef> const & getBounds(LVRef v, BoundT type) const { return boundsOfType(type).at(getVarId(v)); }
+    // Binary search in getBounds(v, type): the index of the first bound with value not below / above the given value
+    int firstBoundNotBelow(LVRef v, BoundT type, Delta const & value) const;
+    int firstBoundAbove(LVRef v, BoundT type, Delta const & value) const;
     bool isUnbounded(LVRef v) const;
     void ensureReadyFor(LVRef v);
 
@@ -14,6 +14,7 @@
 #include "CutCreator.h"
 #include "Random.h"
 
+#include <algorithm>
 #include <unordered_set>
 
 static SolverDescr descr_la_solver("LA Solver", "Solver for Quantifier Free Linear Arithmetics");
@@ -103,7 +104,16 @@ LASolver::LASolver(SolverDescr dls, SMTConfig & c, ArithLogic & l)
         , laVarMapper(l)
         , boundStore(laVarStore)
         , simplex(boundStore)
+        , cutCreator([this](PTRef var) {
+            assert(logic.isVar(var));
+            Delta val = simplex.getValuation(getVarForTerm(var));
+            assert(not val.hasDelta());
+            return val.R();
+        })
 {
+    simplex.setPivotRule(c.lra_pivot_rule());
+    // Row deductions are not supported by the interpolating procedures
+    simplex.setImpliedBoundsRowSize(c.produce_inter() ? 0 : c.lra_poly_deduct_size);
     dec_limit.push(0);
     status = INIT;
 }
@@ -126,6 +136,11 @@ void LASolver::clearSolver()
     decision_trace.clear();
     int_decisions.clear();
     dec_limit.clear();
+    rowDeductions.clear();
+    rowDeductionReasons.clear();
+    rowDeductionLims.clear();
+    cutBirthRounds.clear();
+    cutCreator.clearCache();
     TSolver::clearSolver();
 
     laVarStore.clear();
@@ -265,6 +280,8 @@ LVRef LASolver::getLAVar_single(PTRef expr_in) {
 std::unique_ptr<Tableau::Polynomial> LASolver::expressionToLVarPoly(PTRef term) {
     auto poly = std::make_unique<Tableau::Polynomial>();
     bool negated = laVarMapper.isNegated(term);
+    std::vector<std::pair<LVRef, Real>> terms;
+    terms.reserve(logic.getPterm(term).size());
     for (int i = 0; i < logic.getPterm(term).size(); i++) {
         auto [v,c] = logic.splitTermToVarAndConst(logic.getPterm(term)[i]);
         LVRef var = getLAVar_single(v);
@@ -272,6 +289,11 @@ std::unique_ptr<Tableau::Polynomial> LASolver::expressionToLVarPoly(PTRef term)
         if (negated) {
             coeff.negate();
         }
+        terms.emplace_back(var, std::move(coeff));
+    }
+    // Adding the terms in the order of the variables appends each of them at the end of the polynomial
+    std::sort(terms.begin(), terms.end(), [](auto const & a, auto const & b) { return a.first.x < b.first.x; });
+    for (auto & [var, coeff] : terms) {
         poly->addTerm(var, std::move(coeff));
     }
     return poly;
@@ -464,6 +486,7 @@ bool LASolver::assertLit(PtAsgn asgn)
         setPolarity(asgn.tr, asgn.sgn);
         pushDecision(asgn);
         getSimpleDeductions(it, bound_ref);
+        getRowDeductions(it);
         generalTSolverStats.sat_calls++;
     } else {
         generalTSolverStats.unsat_calls++;
@@ -495,6 +518,7 @@ void LASolver::pushBacktrackPoint( )
     // Check if any updates need to be repeated after backtrack
     simplex.pushBacktrackPoint();
     dec_limit.push(decision_trace.size());
+    rowDeductionLims.push_back({rowDeductions.size(), rowDeductionReasons.size()});
 
     // Update the generic deductions state
     TSolver::pushBacktrackPoint();
@@ -514,7 +538,6 @@ LASolver::popDecisions()
 }
 
 PtAsgn LASolver::popTermBacktrackPoint() {
-    simplex.popBacktrackPoint();
     PtAsgn popd = popDecisions();
     dec_limit.pop();
     return popd;
@@ -529,6 +552,16 @@ void LASolver::popBacktrackPoint( ) {
 // Pop the solver given number of times
 //
 void LASolver::popBacktrackPoints(unsigned int count) {
+    if (count > 0) {
+        // The bounds and the row deductions of all the popped levels are undone at once
+        simplex.popBacktrackPoints(count);
+        assert(count <= rowDeductionLims.size());
+        auto [deductionsLim, reasonsLim] = rowDeductionLims[rowDeductionLims.size() - count];
+        rowDeductionLims.resize(rowDeductionLims.size() - count);
+        rowDeductions.resize(deductionsLim);
+        rowDeductionReasons.resize(reasonsLim);
+    }
+
     for ( ; count > 0; --count){
         PtAsgn dec = popTermBacktrackPoint();
         if (dec != PtAsgn_Undef) {
@@ -632,23 +665,89 @@ void LASolver::getSimpleDeductions(LVRef v, LABoundRef br)
 //    printf("The full bound list for %s:\n%s\n", logic.printTerm(lva[v].getPTRef()), boundStore.printBounds(v));
 
     const LABound& bound = boundStore[br];
+    auto const & sameType = boundStore.getBounds(v, bound.getType());
+    int pos = boundStore.firstBoundNotBelow(v, bound.getType(), bound.getValue());
+    // Different atoms over integer variables may give bounds of the same value
+    while (sameType[pos] != br) {
+        assert(pos + 1 < sameType.size() and boundStore[sameType[pos + 1]].getValue() == bound.getValue());
+        ++pos;
+    }
     if (bound.getType() == bound_l) {
-        for (int it = bound.getIdx().x - 1; it >= 0; it = it - 1) {
-            LABoundRef bound_prop_ref = boundStore.getBoundByIdx(v, it);
-            LABound &bound_prop = boundStore[bound_prop_ref];
-            if (bound_prop.getType() != bound_l)
-                continue;
-            deduce(bound_prop_ref);
+        // All lower bounds below this one hold
+        for (int i = pos - 1; i >= 0; --i) {
+            deduce(sameType[i]);
         }
     } else if (bound.getType() == bound_u) {
-        for (int it = bound.getIdx().x + 1; it < boundStore.getBounds(v).size() - 1; it = it + 1) {
-            LABoundRef bound_prop_ref = boundStore.getBoundByIdx(v, it);
-            LABound & bound_prop = boundStore[bound_prop_ref];
-            if (bound_prop.getType() != bound_u)
-                continue;
-            deduce(bound_prop_ref);
+        // All upper bounds above this one hold
+        for (int i = pos + 1; i < sameType.size(); ++i) {
+            deduce(sameType[i]);
+        }
+    }
+}
+
+void LASolver::getRowDeductions(LVRef v) {
+    impliedBounds.clear();
+    std::size_t const reasonsBegin = rowDeductionReasons.size();
+    simplex.getImpliedBounds(v, impliedBounds, rowDeductionReasons);
+    std::size_t reasonsEnd = reasonsBegin;
+    for (auto const & implied : impliedBounds) {
+        auto const & bounds = boundStore.getBounds(implied.var, implied.type);
+        bool deduced = false;
+        if (implied.type == bound_u) {
+            // All upper bounds not below the implied one hold
+            int const first = boundStore.firstBoundNotBelow(implied.var, bound_u, implied.value);
+            for (int i = bounds.size() - 1; i >= first; --i) {
+                deduced |= deduceFromRow(bounds[i], implied);
+            }
+        } else {
+            // All lower bounds not above the implied one hold
+            int const end = boundStore.firstBoundAbove(implied.var, bound_l, implied.value);
+            for (int i = 0; i < end; ++i) {
+                deduced |= deduceFromRow(bounds[i], implied);
+            }
+        }
+        if (deduced) {
+            reasonsEnd = std::max(reasonsEnd, implied.reasonsEnd);
+        }
+    }
+    // Forget the bounds that do not explain any deduction
+    rowDeductionReasons.resize(reasonsEnd);
+}
+
+bool LASolver::deduceFromRow(LABoundRef bound_prop, Simplex::ImpliedBound const & implied) {
+    PtAsgn ba = getAsgnByBound(bound_prop);
+    if (hasPolarity(ba.tr)) { return false; }
+    rowDeductions.push_back({ba.tr, implied.var, implied.reasonsBegin, implied.reasonsEnd, th_deductions.size_()});
+    storeDeduction(PtAsgn_reason(ba.tr, ba.sgn, PTRef_Undef));
+    ++laSolverStats.num_row_deductions;
+    return true;
+}
+
+vec<PtAsgn> LASolver::getReasonFor(PtAsgn lit) {
+    for (std::size_t i = th_deductions.size_(); i-- > 0; ) {
+        if (th_deductions[i].tr == lit.tr) {
+            return explainDeduction(lit, i);
         }
     }
+    return TSolver::getReasonFor(lit);
+}
+
+vec<PtAsgn> LASolver::explainDeduction(PtAsgn lit, std::size_t index) {
+    auto it = std::lower_bound(rowDeductions.begin(), rowDeductions.end(), index,
+                               [](RowDeduction const & deduction, std::size_t i) { return deduction.deduction < i; });
+    if (it == rowDeductions.end() or it->deduction != index or not isDeduction(lit, index)) {
+        return TSolver::getReasonFor(lit);
+    }
+    RowDeduction const & deduction = *it;
+    vec<PtAsgn> reason;
+    for (std::size_t i = deduction.reasonsBegin; i < deduction.reasonsEnd; ++i) {
+        LABoundRef br = rowDeductionReasons[i];
+        if (boundStore[br].getLVRef() != deduction.var) {
+            reason.push(getAsgnByBound(br));
+        }
+    }
+    reason.push(PtAsgn(lit.tr, lit.sgn == l_True ? l_False : l_True));
+    return reason;
 }
 
 void LASolver::deduce(LABoundRef bound_prop) {
@@ -849,72 +948,24 @@ bool LASolver::shouldTryCutFromProof() const {
 
 namespace {
 
-struct DefiningConstraint {
-    PTRef lhs;
-    opensmt::Real rhs;
-};
-
 /*
- * Translates the set of defining constraints (linear equalities) into a suitable inner representation:
- * - A sparse matrix A of coefficients and constants b
- * - a map from column indices to the corresponding variables x
- * - The result is to be interpreted as the linear system Ax = b
+ * Returns the terms of a linear polynomial as pairs of variables and coefficients
  */
-std::pair<SparseLinearSystem,std::vector<PTRef>> linearSystemFromConstraints(std::vector<DefiningConstraint> const & constraints, ArithLogic & logic) {
-    vec<PTRef> terms;
-    auto fillTerms = [&logic](PTRef poly, vec<PTRef> & terms) {// reduces linear polynomial to a vector of the polynomial's terms
-        terms.clear();
-        if (logic.isPlus(poly)) {
-            for (PTRef arg : logic.getPterm(poly)) {
-                terms.push(arg);
-            }
-        } else {
-            terms.push(poly);
-        }
+CutCreator::RowTerms rowTermsOf(PTRef poly, ArithLogic & logic) {
+    CutCreator::RowTerms rowTerms;
+    auto addTerm = [&](PTRef arg) {
+        auto [var, constant] = logic.splitTermToVarAndConst(arg);
+        assert(var != PTRef_Undef);
+        rowTerms.emplace_back(var, logic.getNumConst(constant));
     };
-    std::unordered_map<PTRef, unsigned, PTRefHash> varIndices;
-    uint32_t columns = 0;
-    // First pass to assign indices and find out number of columns
-    for (auto const & defConstraint : constraints) {
-        PTRef poly = defConstraint.lhs;
-        fillTerms(poly, terms);
-        for (PTRef arg : terms) {
-            auto [var, constant] = logic.splitTermToVarAndConst(arg);
-            assert(var != PTRef_Undef);
-            if (varIndices.find(var) == varIndices.end()) {
-                varIndices.insert({var, columns++});
-            }
+    if (logic.isPlus(poly)) {
+        for (PTRef arg : logic.getPterm(poly)) {
+            addTerm(arg);
         }
+    } else {
+        addTerm(poly);
     }
-
-    uint32_t rows = constraints.size();
-    SparseColMatrix matrixA(RowCount{rows}, ColumnCount{columns});
-    std::vector<FastRational> rhs(rows);
-    std::vector<SparseColMatrix::ColumnPolynomial> columnPolynomials(columns);
-
-    // Second pass to build the actual matrix
-    for (unsigned row = 0; row < constraints.size(); ++row) {
-        rhs[row] = constraints[row].rhs;
-        PTRef poly = constraints[row].lhs;
-        fillTerms(poly, terms);
-        for (PTRef arg : terms) {
-            auto [var, constant] = logic.splitTermToVarAndConst(arg);
-            auto col = varIndices[var];
-            columnPolynomials[col].addTerm(IndexType{row}, logic.getNumConst(constant));
-        }
-    }
-    for (uint32_t i = 0; i < columnPolynomials.size(); ++i) {
-        matrixA.setColumn(ColIndex{i}, std::move(columnPolynomials[i]));
-    }
-    // compute the inverse map from column indices to variables
-    std::vector<PTRef> columnMapping(matrixA.colCount(), PTRef_Undef);
-    for (auto [var, index] : varIndices) {
-        columnMapping[index] = var;
-    }
-
-    assert(matrixA.colCount() == columnMapping.size());
-
-    return {SparseLinearSystem{std::move(matrixA), std::move(rhs)}, std::move(columnMapping)};
+    return rowTerms;
 }
 
 PTRef getSumFromTermVec(SparseColMatrix::TermVec const & termVec, vec<PTRef> const & toVarMap, ArithLogic & logic) {
@@ -946,35 +997,42 @@ TRes LASolver::cutFromProof() {
     auto isOnLowerBound = [this](LVRef var) { return simplex.hasLBound(var) and not simplex.isModelStrictlyOverLowerBound(var); };
     auto isOnUpperBound = [this](LVRef var) { return simplex.hasUBound(var) and not simplex.isModelStrictlyUnderUpperBound(var); };
     // Step 1: Gather defining constraints
-    std::vector<DefiningConstraint> constraints;
+    std::vector<PTRef> constraints;
     for (LVRef var : int_vars) {
         bool isOnLower = isOnLowerBound(var);
         bool isOnUpper = isOnUpperBound(var);
         if (not isOnLower and not isOnUpper) { continue; }
 
-        PTRef term = laVarMapper.getVarPTRef(var);
-        auto const & val = isOnLower ? simplex.Lb(var) : simplex.Ub(var);
-        assert(not val.hasDelta());
-        auto const & rhs = val.R();
-        assert(rhs.isInteger());
-        constraints.push_back(DefiningConstraint{term, rhs});
-//        std::cout << logic.pp(term) << " = " << rhs << std::endl;
+        assert(not (isOnLower ? simplex.Lb(var) : simplex.Ub(var)).hasDelta());
+        assert((isOnLower ? simplex.Lb(var) : simplex.Ub(var)).R().isInteger());
+        constraints.push_back(laVarMapper.getVarPTRef(var));
     }
-    auto getVarValue = [this](PTRef var) {
-        assert(this->logic.isVar(var));
-        LVRef lvar = this->laVarMapper.getVarByPTId(logic.getPterm(var).getId());
-        Delta val = this->simplex.getValuation(lvar);
-        assert(not val.hasDelta());
-        return val.R();
-    };
-    CutCreator cutCreator(getVarValue);
-    auto [system, toVarMap] = linearSystemFromConstraints(constraints, logic);
-    auto cut = cutCreator.makeCut(std::move(system), toVarMap);
-    PTRef split = cutToSplit(std::move(cut), toVarMap, logic);
-    if (split == PTRef_Undef) {
+    CutCreator::CutStats cutStats;
+    auto rowTerms = [this](PTRef term) { return rowTermsOf(term, logic); };
+    auto cuts = cutCreator.makeCuts(constraints, rowTerms, {maxCutsPerRound, maxCutTerms, maxCutCoeff}, cutStats);
+    auto const & toVarMap = cutCreator.getColumnMapping();
+    int const round = ++laSolverStats.num_cut_rounds;
+    laSolverStats.num_cut_candidates += cutStats.candidates;
+    laSolverStats.num_cuts_too_dense += cutStats.tooDense;
+    laSolverStats.num_cuts_too_large += cutStats.tooLarge;
+    laSolverStats.num_hnf_rows_reused += cutStats.rowsReused;
+    laSolverStats.num_hnf_rows_added += cutStats.rowsAdded;
+    laSolverStats.num_hnf_rows_removed += cutStats.rowsRemoved;
+    std::unordered_set<PTRef, PTRefHash> splits;
+    for (auto & cut : cuts) {
+        PTRef split = cutToSplit(std::move(cut), toVarMap, logic);
+        if (split == PTRef_Undef or not splits.insert(split).second) { continue; }
+        auto [it, inserted] = cutBirthRounds.insert({split, round});
+        if (not inserted) {
+            ++laSolverStats.num_cuts_repeated;
+            laSolverStats.repeated_cuts_age += round - it->second;
+        }
+        ++laSolverStats.num_cuts;
+        splitondemand.push(split);
+    }
+    if (splits.empty()) {
         return TRes::UNKNOWN;
     }
-    splitondemand.push(split);
     setStatus(NEWSPLIT);
     return TRes::SAT;
 }
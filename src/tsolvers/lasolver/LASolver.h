@@ -18,6 +18,7 @@
 #include "Simplex.h"
 #include "FarkasInterpolator.h"
 #include "LAVarMapper.h"
+#include "CutCreator.h"
 
 #include <unordered_map>
 #include <unordered_set>
@@ -30,12 +31,36 @@ class LASolverStats
 {
     public:
         int num_vars;
+        int num_row_deductions;
+        int num_cut_rounds;
+        int num_cuts;
+        int num_cut_candidates;
+        int num_cuts_too_dense;
+        int num_cuts_too_large;
+        int num_cuts_repeated;
+        uint64_t repeated_cuts_age; // Sum over the repeated cuts of the number of rounds since the cut was first made
+        uint64_t num_hnf_rows_reused;
+        uint64_t num_hnf_rows_added;
+        uint64_t num_hnf_rows_removed;
         opensmt::OSMTTimeVal timer;
 
-        LASolverStats() : num_vars(0) {}
+        LASolverStats() : num_vars(0), num_row_deductions(0), num_cut_rounds(0), num_cuts(0), num_cut_candidates(0),
+            num_cuts_too_dense(0), num_cuts_too_large(0), num_cuts_repeated(0), repeated_cuts_age(0),
+            num_hnf_rows_reused(0), num_hnf_rows_added(0), num_hnf_rows_removed(0) {}
 
         void printStatistics(std::ostream& os) {
             os << "; Number of LA vars........: " << num_vars << '\n';
+            os << "; Row deductions...........: " << num_row_deductions << '\n';
+            os << "; Cut rounds...............: " << num_cut_rounds << '\n';
+            os << "; Cuts.....................: " << num_cuts << " of " << num_cut_candidates << " candidates ("
+               << num_cuts_too_dense << " too dense, " << num_cuts_too_large << " too large)" << '\n';
+            os << "; Repeated cuts............: " << num_cuts_repeated;
+            if (num_cuts_repeated > 0) {
+                os << " (average age " << static_cast<double>(repeated_cuts_age) / num_cuts_repeated << " rounds)";
+            }
+            os << '\n';
+            os << "; HNF rows.................: " << num_hnf_rows_reused << " reused, " << num_hnf_rows_added << " added, "
+               << num_hnf_rows_removed << " removed" << '\n';
             os << "; LA time..................: " << timer.getTime() << " s\n";
         }
 };
@@ -67,6 +92,15 @@ private:
 
     std::vector<opensmt::Real> explanationCoefficients;
 
+    // Literals deduced from the rows of the initial tableau; their reasons are built from the stored bounds only on demand.
+    // The deductions are ordered by their index among all the deductions of the solver.
+    struct RowDeduction { PTRef tr; LVRef var; std::size_t reasonsBegin; std::size_t reasonsEnd; std::size_t deduction; };
+    struct RowDeductionLim { std::size_t deductions; std::size_t reasons; };
+    std::vector<RowDeduction> rowDeductions;
+    std::vector<LABoundRef> rowDeductionReasons;
+    std::vector<RowDeductionLim> rowDeductionLims;
+    std::vector<Simplex::ImpliedBound> impliedBounds;
+
     vec<PtAsgn>          LABoundRefToLeqAsgn;
     PtAsgn getAsgnByBound(LABoundRef br) const;
     vec<LABoundRefPair>  LeqToLABoundRefPair;
@@ -110,6 +144,8 @@ public:
     void  pushBacktrackPoint ( ) override;                       // Push a backtrack point
     void  popBacktrackPoint  ( ) override;                       // Backtrack to last saved point
     void  popBacktrackPoints ( unsigned int ) override;         // Backtrack given number of saved points
+    vec<PtAsgn> getReasonFor(PtAsgn lit) override;
+    vec<PtAsgn> explainDeduction(PtAsgn lit, std::size_t index) override;
     lbool getPolaritySuggestion(PTRef) const;
     vec<PTRef> collectEqualitiesFor(vec<PTRef> const & vars, std::unordered_set<PTRef, PTRefHash> const & knownEqualities) override;
 
@@ -158,9 +194,20 @@ private:
     bool isModelInteger (LVRef v) const;
     TRes cutFromProof();
     bool shouldTryCutFromProof() const;
+    // The round of cutFromProof in which each cut was first made
+    std::unordered_map<PTRef, int, PTRefHash> cutBirthRounds;
+    // Keeps the Hermite normal form of the defining constraints between the rounds
+    CutCreator cutCreator;
+    // Limits on the cuts added in one round besides the first one.  Dense cuts or cuts with large coefficients
+    // introduce atoms that slow down the search more than the cuts help.
+    static constexpr std::size_t maxCutsPerRound = 4;
+    static constexpr std::size_t maxCutTerms = 4;
+    static constexpr int maxCutCoeff = 100;
 
     void getSuggestions( vec<PTRef>& dst, SolverId solver_id );                                   // find possible suggested atoms
     void getSimpleDeductions(LVRef v, LABoundRef);      // find deductions from actual bounds position
+    void getRowDeductions(LVRef v);                     // find deductions from the bounds of the rows containing v
+    bool deduceFromRow(LABoundRef, Simplex::ImpliedBound const &);
     unsigned getIteratorByPTRef( PTRef e, bool );                                                 // find bound iterator by the PTRef
     inline bool getStatus( );                               // Read the status of the solver in lbool
     bool setStatus( LASolverStatus );               // Sets and return status of the solver
@@ -34,10 +34,7 @@ void
 LRAModel::write(const LVRef &v, Delta val)
 {
     current_assignment[getVarId(v)] = std::move(val);
-    if (!changed_vars_set.contains(getVarId(v))) {
-        changed_vars_set.insert(getVarId(v));
-        changed_vars_vec.push(v);
-    }
+    markChanged(v);
 }
 
 
@@ -56,9 +53,9 @@ LRAModel::pushBound(const LABoundRef br) {
 }
 
 void
-LRAModel::popBounds()
+LRAModel::popBounds(int limit)
 {
-    for (int i = bound_trace.size()-1; i >= bound_limits.last(); i--) {
+    for (int i = bound_trace.size()-1; i >= limit; i--) {
         LABoundRef br = bound_trace[i];
         LABound &b = bs[br];
         LVRef vr = b.getLVRef();
@@ -68,7 +65,7 @@ LRAModel::popBounds()
             int_lbounds[getVarId(vr)].pop();
         }
     }
-    bound_trace.shrink(bound_trace.size() - bound_limits.last());
+    bound_trace.shrink(bound_trace.size() - limit);
 }
 
 void LRAModel::clear() {
@@ -94,7 +91,12 @@ const LABound& LRAModel::readLBound(const LVRef &v) const { return bs[readLBound
 LABoundRef LRAModel::readUBoundRef(LVRef v) const { assert(hasUBound(v)); return int_ubounds[getVarId(v)].last(); }
 const LABound& LRAModel::readUBound(const LVRef &v) const { return bs[readUBoundRef(v)]; }
 void LRAModel::pushBacktrackPoint()      { bound_limits.push(bound_trace.size()); }
-void LRAModel::popBacktrackPoint() { popBounds(); bound_limits.pop(); }; // Returns the decision if the backtrack point had a decision
+void LRAModel::popBacktrackPoint() { popBacktrackPoints(1); }
+void LRAModel::popBacktrackPoints(unsigned int count) {
+    assert(count > 0 && count < static_cast<unsigned>(bound_limits.size()));
+    popBounds(bound_limits[bound_limits.size() - count]);
+    bound_limits.shrink(count);
+}
 int  LRAModel::getBacktrackSize() const { return bound_limits.size(); }
 
 bool LRAModel::isEquality(LVRef v) const {
@@ -34,7 +34,13 @@ protected:
     int n_vars_with_model;
     Map<LVRef,bool,LVRefHash> has_model;
     int          backtrackLevel();
-    void         popBounds();
+    void         popBounds(int limit);
+    inline void  markChanged(LVRef v) {
+        if (!changed_vars_set.contains(getVarId(v))) {
+            changed_vars_set.insert(getVarId(v));
+            changed_vars_vec.push(v);
+        }
+    }
 
 public:
     LRAModel(LABoundStore & bs) : bs(bs), n_vars_with_model(0) { bound_limits.push(0); }
@@ -43,6 +49,9 @@ public:
     inline int   nVars() { return n_vars_with_model; }
 
     void         write(const LVRef &v, Delta);
+    // In-place updates of the value of v: v += diff and v += coeff * diff
+    inline void  add(LVRef v, const Delta & diff) { markChanged(v); current_assignment[getVarId(v)] += diff; }
+    inline void  addScaled(LVRef v, const Delta & diff, const Real & coeff) { markChanged(v); current_assignment[getVarId(v)].addScaled(diff, coeff); }
     inline const Delta& read (const LVRef &v) const { return current_assignment[getVarId(v)]; }
 private:
     // needed from Simplex to make all work properly with backtracking and quasi-basic variables
@@ -65,6 +74,7 @@ public:
     inline const Delta& Ub(LVRef v) const { return readUBound(v).getValue(); }
     void pushBacktrackPoint();
     void popBacktrackPoint();
+    void popBacktrackPoints(unsigned int count); // Undoes the bounds of all count levels in one pass over the trail
     int  getBacktrackSize() const ;
 
     bool isEquality(LVRef v) const;
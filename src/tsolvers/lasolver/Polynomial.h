@@ -101,7 +101,6 @@ void PolynomialT<VarType>::merge(PolynomialT<VarType> const & other, opensmt::Re
     auto myEnd = std::make_move_iterator(poly.end());
     auto otherEnd = other.poly.cend();
     TermCmp cmp;
-    FastRational tmp;
     while(true) {
         if (myIt == myEnd) {
             for (auto it = otherIt; it != otherEnd; ++it) {
@@ -131,8 +130,7 @@ void PolynomialT<VarType>::merge(PolynomialT<VarType> const & other, opensmt::Re
         }
         else {
             assert(myIt->var == otherIt->var);
-            multiplication(tmp, otherIt->coeff, coeff);
-            myIt->coeff += tmp;
+            addProductAssign(myIt->coeff, otherIt->coeff, coeff);
             if (myIt->coeff.isZero()) {
                 informRemoved(myIt->var);
             }
@@ -45,6 +45,10 @@ Simplex::Explanation Simplex::checkSimplex() {
             x = getBasicVarToFixByBland();
             ++simplex_stats.num_bland_ops;
         }
+        else if (pivotRule == lra_pivot_rule_steepest_edge) {
+            x = getBasicVarToFixBySteepestEdge();
+            ++simplex_stats.num_steepest_edge_ops;
+        }
         else {
             x = getBasicVarToFixByShortestPoly();
             ++simplex_stats.num_pivot_ops;
@@ -94,33 +98,28 @@ bool Simplex::isUnbounded(LVRef v) const {
     return model->isUnbounded(v);
 }
 
-LVRef Simplex::getBasicVarToFixByShortestPoly() const {
-    assert(std::all_of(candidates.begin(), candidates.end(),
-                       [&](LVRef var) {
-                           return var != LVRef::Undef && tableau.isBasic(var) && isModelOutOfBounds(var);
-                       }));
-    // MB: replace this with std::min_element when ranges are available (to avoid duplicate calls to getPolySize)
-    LVRef current = LVRef::Undef;
-    std::size_t current_poly_size = std::numeric_limits<std::size_t>::max();
-    for (auto it : candidates) { // Select the var with smallest row
-        bool const doUpdate = tableau.getPolySize(it) < current_poly_size;
-        if (doUpdate) {
-            current = it;
-            current_poly_size = tableau.getPolySize(it);
+bool Simplex::checkCandidates() const {
+    for (int i = 0; i < candidates.size(); ++i) {
+        LVRef var {static_cast<uint32_t>(candidates[i])};
+        if (not tableau.isBasic(var) or not isModelOutOfBounds(var) or candidateScores[getVarId(var)] != tableau.getPolySize(var)) {
+            return false;
         }
     }
-    return current;
+    return true;
+}
+
+LVRef Simplex::getBasicVarToFixByShortestPoly() const {
+    assert(checkCandidates());
+    // The top of the heap is the var with the smallest row
+    return candidates.empty() ? LVRef::Undef : LVRef{static_cast<uint32_t>(candidates[0])};
 }
 
 LVRef Simplex::getBasicVarToFixByBland() const {
-    assert(std::all_of(candidates.begin(), candidates.end(),
-                       [&](LVRef var) {
-                           return var != LVRef::Undef && tableau.isBasic(var) && isModelOutOfBounds(var);
-                       }));
-    // MB: replace this with std::min_element when ranges are available (to avoid duplicate calls to getVarId)
+    assert(checkCandidates());
     auto curr_var_id_x = std::numeric_limits<unsigned>::max();
     LVRef current = LVRef::Undef;
-    for (auto it : candidates) { // Select the var with the smallest id
+    for (int i = 0; i < candidates.size(); ++i) { // Select the var with the smallest id
+        LVRef it {static_cast<uint32_t>(candidates[i])};
         auto const id = getVarId(it);
         bool const doUpdate = id < curr_var_id_x;
         if (doUpdate) {
@@ -131,6 +130,27 @@ LVRef Simplex::getBasicVarToFixByBland() const {
     return current;
 }
 
+LVRef Simplex::getBasicVarToFixBySteepestEdge() const {
+    assert(checkCandidates());
+    // Select the var with the largest infeasibility relative to its reference weight.
+    // The infinitesimal part of the infeasibility only matters when the real parts are equal.
+    LVRef current = LVRef::Undef;
+    std::pair<double, double> currentScore {-1, -1};
+    for (int i = 0; i < candidates.size(); ++i) {
+        LVRef it {static_cast<uint32_t>(candidates[i])};
+        Delta const infeasibility = overBound(it);
+        double const weight = edgeWeights[getVarId(it)];
+        double const r = infeasibility.R().get_d();
+        double const d = infeasibility.D().get_d();
+        std::pair<double, double> score {r * r / weight, d * d / weight};
+        if (score > currentScore or (score == currentScore and getVarId(it) < getVarId(current))) {
+            current = it;
+            currentScore = score;
+        }
+    }
+    return current;
+}
+
 LVRef Simplex::findNonBasicForPivotByHeuristic(LVRef basicVar) {
     // favor more independent variables: those present in less rows
     assert(tableau.isBasic(basicVar));
@@ -255,11 +275,24 @@ Simplex::Explanation Simplex::assertBoundOnVar(LVRef it, LABoundRef itBound_ref)
 
 void Simplex::newCandidate(LVRef candidateVar) {
     assert(tableau.isBasic(candidateVar));
-    candidates.insert(candidateVar);
+    auto id = getVarId(candidateVar);
+    if (candidates.inHeap(id)) { return; }
+    candidateScores[id] = tableau.getPolySize(candidateVar);
+    candidates.insert(id);
 }
 
 void Simplex::eraseCandidate(LVRef candidateVar) {
-    candidates.erase(candidateVar);
+    auto id = getVarId(candidateVar);
+    if (candidates.inHeap(id)) {
+        candidates.remove(id);
+    }
+}
+
+void Simplex::updateCandidateScore(LVRef candidateVar) {
+    auto id = getVarId(candidateVar);
+    assert(candidates.inHeap(id));
+    candidateScores[id] = tableau.getPolySize(candidateVar);
+    candidates.update(id);
 }
 
 
@@ -269,9 +302,18 @@ void Simplex::pivot(const LVRef bv, const LVRef nv){
     simplex_assert(valueConsistent(bv));
 //    tableau.print();
     updateValues(bv, nv);
+    if (pivotRule == lra_pivot_rule_steepest_edge) {
+        updateEdgeWeights(bv, nv);
+    }
     tableau.pivot(bv, nv);
     // after pivot, bv is not longer a candidate
     eraseCandidate(bv);
+    // the rows where nv has been substituted have changed their length
+    for (LVRef row : tableau.getColumn(bv)) {
+        if (candidates.inHeap(getVarId(row))) {
+            updateCandidateScore(row);
+        }
+    }
     // and nv can be a candidate
     if (getNumOfBoundsActive(nv) == 0) {
         tableau.basicToQuasi(nv);
@@ -286,14 +328,109 @@ void Simplex::pivot(const LVRef bv, const LVRef nv){
     simplex_assert(checkValueConsistency());
 }
 
+void Simplex::updateEdgeWeights(LVRef bv, LVRef nv) {
+    // Devex update: the weight of a row changed by the pivot is at least the weight of the pivot row scaled by
+    // the square of the multiplier used to eliminate nv from it.
+    double const pivotCoeff = tableau.getCoeff(bv, nv).get_d();
+    double const bvWeight = edgeWeights[getVarId(bv)];
+    bool reset = false;
+    for (LVRef row : tableau.getColumn(nv)) {
+        if (row == bv or not tableau.isBasic(row)) { continue; }
+        double const ratio = tableau.getCoeff(row, nv).get_d() / pivotCoeff;
+        double & weight = edgeWeights[getVarId(row)];
+        weight = std::max(weight, ratio * ratio * bvWeight);
+        reset |= weight > maxEdgeWeight;
+    }
+    edgeWeights[getVarId(nv)] = std::max(bvWeight / (pivotCoeff * pivotCoeff), 1.0);
+    // The approximation gets inaccurate as the weights grow, start over with a new reference framework
+    if (reset) {
+        std::fill(edgeWeights.begin(), edgeWeights.end(), 1.0);
+    }
+}
+
+void Simplex::addDefinition(LVRef x, Tableau::Polynomial const & poly) {
+    if (poly.size() + 1 > impliedBoundsRowSize) { return; }
+    definitions[getVarId(x)] = TableauRow(Tableau::Polynomial(poly));
+    for (LVRef var : definitions[getVarId(x)].getVars()) {
+        assert(getVarId(var) < definitionsWithVar.size());
+        definitionsWithVar[getVarId(var)].push_back(x);
+    }
+}
+
+void Simplex::getImpliedBounds(LVRef var, std::vector<ImpliedBound> & implied, std::vector<LABoundRef> & reasons) const {
+    if (impliedBoundsRowSize == 0) { return; }
+    if (definitions[getVarId(var)].size() > 0) {
+        getRowImpliedBounds(var, implied, reasons);
+    }
+    for (LVRef rowVar : definitionsWithVar[getVarId(var)]) {
+        getRowImpliedBounds(rowVar, implied, reasons);
+    }
+}
+
+void Simplex::getRowImpliedBounds(LVRef rowVar, std::vector<ImpliedBound> & implied, std::vector<LABoundRef> & reasons) const {
+    auto const & row = definitions[getVarId(rowVar)];
+    // The row states 0 = -rowVar + sum c_i x_i; treat rowVar as a term with coefficient -1
+    opensmt::Real const minusOne(-1);
+    auto forEachTerm = [&](auto && f) {
+        f(rowVar, minusOne);
+        for (auto const & term : row) {
+            f(term.var, term.coeff);
+        }
+    };
+    // If every term c*v has a lower bound, then for each term c*v <= -(sum of the lower bounds of the other terms).
+    // Dually with upper bounds. The bound of c*v is given by the lower or upper bound of v, depending on the sign of c.
+    for (bool fromLower : {true, false}) {
+        auto termBound = [&](LVRef v, opensmt::Real const & c) {
+            if (isPositive(c) == fromLower) {
+                return model->hasLBound(v) ? model->readLBoundRef(v) : LABoundRef_Undef;
+            }
+            return model->hasUBound(v) ? model->readUBoundRef(v) : LABoundRef_Undef;
+        };
+        std::size_t const begin = reasons.size();
+        Delta sum(0);
+        unsigned missing = 0;
+        LVRef missingVar = LVRef::Undef;
+        forEachTerm([&](LVRef v, opensmt::Real const & c) {
+            LABoundRef bound = termBound(v, c);
+            if (bound == LABoundRef_Undef) {
+                ++missing;
+                missingVar = v;
+            } else {
+                sum.addScaled(boundStore[bound].getValue(), c);
+                reasons.push_back(bound);
+            }
+        });
+        std::size_t const end = reasons.size();
+        bool used = false;
+        if (missing <= 1) {
+            forEachTerm([&](LVRef v, opensmt::Real const & c) {
+                if (missing == 1 and v != missingVar) { return; }
+                if (boundStore.getBounds(v).size() == 0) { return; } // No atoms to deduce
+                Delta rest = sum;
+                if (missing == 0) {
+                    rest.subScaled(boundStore[termBound(v, c)].getValue(), c);
+                }
+                rest.negate();
+                rest /= c;
+                BoundT type = isPositive(c) == fromLower ? bound_u : bound_l;
+                implied.push_back({v, std::move(rest), type, begin, end});
+                used = true;
+            });
+        }
+        if (not used) {
+            reasons.resize(begin);
+        }
+    }
+}
+
 void Simplex::changeValueBy(LVRef var, const Delta & diff) {
     // update var's value
-    model->write(var, model->read(var) + diff);
+    model->add(var, diff);
     // update all (active) rows where var is present
     for ( LVRef row : tableau.getColumn(var)){
         assert(!tableau.isNonBasic(row));
         if (tableau.isBasic(row)) { // skip quasi-basic variables
-            model->write(row, model->read(row) + (tableau.getCoeff(row, var) * diff));
+            model->addScaled(row, diff, tableau.getCoeff(row, var));
             if (isModelOutOfBounds(row)) {
                 newCandidate(row);
             }
@@ -309,7 +446,9 @@ void Simplex::updateValues(const LVRef bv, const LVRef nv){
     auto const & bvNewVal = (isModelOutOfLowerBound(bv)) ? model->Lb(bv) : model->Ub(bv);
     const auto & coeff = tableau.getCoeff(bv, nv);
     // nvDiff represents how much we need to change nv, so that bv gets to the right value
-    auto nvDiff = (bvNewVal - model->read(bv)) / coeff;
+    Delta nvDiff = bvNewVal;
+    nvDiff -= model->read(bv);
+    nvDiff /= coeff;
     // update nv's value
     changeValueBy(nv, nvDiff);
 }
@@ -343,11 +482,8 @@ Simplex::Explanation Simplex::getConflictingBounds(LVRef x, bool conflictOnLower
 
 bool Simplex::checkValueConsistency() const {
     bool res = true;
-    auto const & rows = tableau.getRows();
-    for (unsigned i = 0; i < rows.size(); ++i) {
-        if (!rows[i]) { continue; }
+    for (unsigned i = 0; i < tableau.getNumOfCols(); ++i) {
         LVRef var {i};
-        assert(!tableau.isNonBasic(var));
         if (tableau.isBasic(var)) {
             res &= valueConsistent(var);
         }
@@ -360,8 +496,8 @@ bool Simplex::valueConsistent(LVRef v) const
 {
     const Delta& value = model->read(v);
     Delta sum(0);
-    for (auto & term : tableau.getRowPoly(v)){
-      sum += term.coeff * model->read(term.var);
+    for (auto const & term : tableau.getRowPoly(v)){
+      sum.addScaled(model->read(term.var), term.coeff);
     }
 
     assert(value == sum);
@@ -487,6 +623,8 @@ void Simplex::quasiToBasic(LVRef it) {
 Simplex::~Simplex()
 {
 #ifdef STATISTICS
+     simplex_stats.num_word_coeff_ops = tableau.getCoeffOpStats().wordOps;
+     simplex_stats.num_rational_coeff_ops = tableau.getCoeffOpStats().rationalOps;
      simplex_stats.printStatistics(cerr);
 #endif // STATISTICS
 }
@@ -510,7 +648,7 @@ void Simplex::processBufferOfActivatedBounds() {
                 newCandidate(var);
             } else {
                 // MB: Experience shows this should really not happen
-                assert(candidates.find(var) == candidates.end());
+                assert(not candidates.inHeap(getVarId(var)));
             }
         }
     }
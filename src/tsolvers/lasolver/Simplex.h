@@ -10,12 +10,16 @@
 #include "lasolver/LAVar.h"
 #include "LRAModel.h"
 #include "SMTConfig.h"
+#include "Heap.h"
 
 class SimplexStats {
 public:
     int num_bland_ops;
     int num_pivot_ops;
-    SimplexStats() : num_bland_ops(0), num_pivot_ops(0) {}
+    int num_steepest_edge_ops;
+    uint64_t num_word_coeff_ops;
+    uint64_t num_rational_coeff_ops;
+    SimplexStats() : num_bland_ops(0), num_pivot_ops(0), num_steepest_edge_ops(0), num_word_coeff_ops(0), num_rational_coeff_ops(0) {}
     void printStatistics(std::ostream& os)
     {
         os << "; -------------------------" << '\n';
@@ -23,6 +27,9 @@ public:
         os << "; -------------------------" << '\n';
         os << "; Pivot operations.........: " << num_pivot_ops << '\n';
         os << "; Bland operations.........: " << num_bland_ops << '\n';
+        os << "; Steepest-edge operations.: " << num_steepest_edge_ops << '\n';
+        os << "; Word coefficient ops.....: " << num_word_coeff_ops << '\n';
+        os << "; Rational coefficient ops.: " << num_rational_coeff_ops << '\n';
     }
 };
 
@@ -32,20 +39,32 @@ class Simplex {
 
     Tableau tableau;
     SimplexStats simplex_stats;
+    LRAPivotRule pivotRule = lra_pivot_rule_shortest_row;
     void  pivot(LVRef basic, LVRef nonBasic);
     LVRef getBasicVarToFixByBland() const;
     LVRef getBasicVarToFixByShortestPoly() const;
+    LVRef getBasicVarToFixBySteepestEdge() const;
     LVRef findNonBasicForPivotByBland(LVRef basicVar);
     LVRef findNonBasicForPivotByHeuristic(LVRef basicVar);
     void  updateValues(LVRef basicVar, LVRef nonBasicVar);
+    // Devex approximation of the (dual) steepest-edge reference weights of the basic variables
+    std::vector<double> edgeWeights;
+    static constexpr double maxEdgeWeight = 1e6;
+    void  updateEdgeWeights(LVRef basicVar, LVRef nonBasicVar);
     inline void newCandidate(LVRef candidateVar);
     inline void eraseCandidate(LVRef candidateVar);
 
     void changeValueBy( LVRef, const Delta & );             // Updates the bounds after constraint pushing
     void refineBounds() { return; }                         // Compute the bounds for touched polynomials and deduces new bounds from it
-    // Out of bound candidates
-    // mutable std::unordered_set<LVRef, LVRefHash> candidates;
-    mutable std::set<LVRef, LVRefComp> candidates;
+    // Out of bound candidates, ordered by the length of their row (shorter first) and then by their id
+    struct CandidateLt {
+        std::vector<uint32_t> const & score;
+        bool operator()(int x, int y) const { return score[x] < score[y] or (score[x] == score[y] and x < y); }
+        CandidateLt(std::vector<uint32_t> const & score) : score(score) {}
+    };
+    std::vector<uint32_t> candidateScores;
+    Heap<CandidateLt> candidates;
+    void updateCandidateScore(LVRef candidateVar);
 //    bool isEquality(LVRef) const;
     const Delta overBound(LVRef) const;
     // Model & bounds
@@ -55,6 +74,7 @@ class Simplex {
 
     bool valueConsistent(LVRef v) const; // Debug: Checks that the value of v in the model is consistent with the evaluated value of the polynomial of v in the same model.
     bool checkTableauConsistency() const;
+    bool checkCandidates() const;
 public:
     struct ExplTerm {
         LABoundRef boundref;
@@ -62,16 +82,38 @@ public:
     };
     using Explanation = std::vector<ExplTerm>;
 
-    Simplex(std::unique_ptr<LRAModel> model, LABoundStore &bs) : model(std::move(model)), boundStore(bs) {}
-    Simplex(LABoundStore&bs) : model(new LRAModel(bs)), boundStore(bs) {}
+    // A bound on a variable of a row implied by the row and the active bounds of the other variables of the row
+    struct ImpliedBound {
+        LVRef var;
+        Delta value;
+        BoundT type;
+        // The bounds the implied bound is derived from are reasons[reasonsBegin, reasonsEnd), except a bound of var itself
+        std::size_t reasonsBegin;
+        std::size_t reasonsEnd;
+    };
+private:
+    // The rows of the initial tableau, i.e., the definitions of the compound terms over the problem variables.
+    // Unlike the current rows, these do not change with pivoting and are available also for quasi-basic variables.
+    // Only rows with at most impliedBoundsRowSize variables are kept.
+    std::size_t impliedBoundsRowSize = 0;
+    std::vector<TableauRow> definitions;
+    std::vector<std::vector<LVRef>> definitionsWithVar;
+    void addDefinition(LVRef x, Tableau::Polynomial const & poly);
+    void getRowImpliedBounds(LVRef rowVar, std::vector<ImpliedBound> & implied, std::vector<LABoundRef> & reasons) const;
+public:
+
+    Simplex(std::unique_ptr<LRAModel> model, LABoundStore &bs) : model(std::move(model)), boundStore(bs), candidates(CandidateLt(candidateScores)) {}
+    Simplex(LABoundStore&bs) : model(new LRAModel(bs)), boundStore(bs), candidates(CandidateLt(candidateScores)) {}
     ~Simplex();
 
     void initModel() { model->init(); }
+    void setPivotRule(LRAPivotRule rule) { pivotRule = rule; }
 
-    void clear() { model->clear(); candidates.clear(); tableau.clear(); boundsActivated.clear(); }
+    void clear() { model->clear(); candidates.clear(); tableau.clear(); boundsActivated.clear(); candidateScores.clear(); edgeWeights.clear(); definitions.clear(); definitionsWithVar.clear(); }
     Explanation checkSimplex();
     void pushBacktrackPoint() { model->pushBacktrackPoint(); }
     void popBacktrackPoint()  { model->popBacktrackPoint(); }
+    void popBacktrackPoints(unsigned int count) { model->popBacktrackPoints(count); }
     inline void finalizeBacktracking() {
         assert(model->changed_vars_vec.size() == 0);
         candidates.clear();
@@ -95,8 +137,12 @@ public:
 
     void newNonbasicVar(LVRef v) { newVar(v); tableau.newNonbasicVar(v); }
     void nonbasicVar(LVRef v)    { newVar(v); tableau.nonbasicVar(v); }
-    void newRow(LVRef x, std::unique_ptr<Tableau::Polynomial> poly) { newVar(x); tableau.newRow(x, std::move(poly)); }
+    void newRow(LVRef x, std::unique_ptr<Tableau::Polynomial> poly) { newVar(x); addDefinition(x, *poly); tableau.newRow(x, std::move(poly)); }
     Explanation getConflictingBounds(LVRef x, bool conflictOnLower);
+    // Collects the bounds implied by the rows of the initial tableau containing var.
+    // Only rows with at most maxRowSize variables are considered; 0 disables the collection.
+    void setImpliedBoundsRowSize(std::size_t maxRowSize) { impliedBoundsRowSize = maxRowSize; }
+    void getImpliedBounds(LVRef var, std::vector<ImpliedBound> & implied, std::vector<LABoundRef> & reasons) const;
     bool checkValueConsistency() const;
     bool invariantHolds() const;
 
@@ -121,6 +167,10 @@ private:
     void newVar(LVRef v) {
         while (getVarId(v) >= boundsActivated.size()) {
             boundsActivated.push_back(0);
+            candidateScores.push_back(0);
+            edgeWeights.push_back(1.0);
+            definitions.emplace_back();
+            definitionsWithVar.emplace_back();
         }
         model->addVar(v);
         boundStore.ensureReadyFor(v);
@@ -44,7 +44,16 @@ const FastRational * SparseColMatrix::Col::tryGetCoeffFor(RowIndex rowIndex) con
     return it->var == bound ? &it->coeff : nullptr;
 }
 
+void SparseColMatrix::Col::removeTerm(RowIndex rowIndex) {
+    if (tryGetCoeffFor(rowIndex)) {
+        poly.removeVar(IndexType{rowIndex.count});
+    }
+}
+
 namespace {
+    using ColumnOperation = IncrementalHermiteNormalForm::ColumnOperation;
+    using OperationLog = IncrementalHermiteNormalForm::OperationLog;
+
     SparseColMatrix identityMatrix(uint32_t size) {
         SparseColMatrix id(RowCount{size}, ColumnCount{size});
         for (uint32_t i = 0; i < size; ++i) {
@@ -55,28 +64,33 @@ namespace {
         return id;
     }
 
-    void negateColumn(SparseColMatrix & A, ColIndex colIndex, SparseColMatrix & U) {
+    // The operations below are recorded in log, if given
+
+    void negateColumn(SparseColMatrix & A, ColIndex colIndex, SparseColMatrix & U, OperationLog * log = nullptr) {
         A[colIndex].negate();
         U[colIndex].negate();
+        if (log) { log->push_back({ColumnOperation::Kind::Negate, colIndex, colIndex, 0}); }
     }
 
-    void swapColumns(SparseColMatrix & A, ColIndex pivotIndex, ColIndex otherIndex, SparseColMatrix & U) {
+    void swapColumns(SparseColMatrix & A, ColIndex pivotIndex, ColIndex otherIndex, SparseColMatrix & U, OperationLog * log = nullptr) {
         assert(pivotIndex != otherIndex);
         A.swapCols(pivotIndex, otherIndex);
         U.swapCols(pivotIndex, otherIndex);
+        if (log) { log->push_back({ColumnOperation::Kind::Swap, pivotIndex, otherIndex, 0}); }
     }
 
-    void addColumnMultiple(SparseColMatrix & A, ColIndex colFrom, opensmt::Real const & multiple, ColIndex colTo, SparseColMatrix & U) {
+    void addColumnMultiple(SparseColMatrix & A, ColIndex colFrom, opensmt::Real const & multiple, ColIndex colTo, SparseColMatrix & U, OperationLog * log = nullptr) {
         A[colTo].add(A[colFrom], multiple);
         // For U we do the inverse operation: colFrom += -multiple * colTo
         U[colFrom].add(U[colTo], -multiple);
+        if (log) { log->push_back({ColumnOperation::Kind::AddMultiple, colFrom, colTo, multiple}); }
     }
 
 /*
  * Normalizes row so that all entries to the right of pivot are zero.
  * Returns true if the pivot is non-zero.
  */
-    bool normalizeRow(SparseColMatrix & A, RowIndex rowIndex, ColIndex pivotIndex, SparseColMatrix & U) {
+    bool normalizeRow(SparseColMatrix & A, RowIndex rowIndex, ColIndex pivotIndex, SparseColMatrix & U, OperationLog * log = nullptr) {
         // Collect all columns with non-zero entry at given row; ensure they are positive
         std::vector<ColIndex> activeColumns;
         auto size = A.colCount();
@@ -85,7 +99,7 @@ namespace {
             if (A[col].isFirst(rowIndex)) {
                 activeColumns.push_back(ColIndex{col});
                 if (A[col].getFirstCoeff().sign() < 0) {
-                    negateColumn(A, ColIndex{col}, U);
+                    negateColumn(A, ColIndex{col}, U, log);
                 }
             }
         }
@@ -107,7 +121,7 @@ namespace {
                 auto const & nextCol = A[activeColumns[nextColIndex]];
                 auto quotient = -fastrat_fdiv_q(nextCol.getFirstCoeff(), smallestValue);
                 assert(not quotient.isZero());
-                addColumnMultiple(A, activeColumns[0], quotient, activeColumns[nextColIndex], U);
+                addColumnMultiple(A, activeColumns[0], quotient, activeColumns[nextColIndex], U, log);
                 if (not nextCol.isFirst(rowIndex)) { // the entry in this column is zero now, remove the column from active set
                     std::swap(activeColumns[nextColIndex], activeColumns.back());
                     activeColumns.pop_back();
@@ -120,12 +134,12 @@ namespace {
         // Single active column left, move it to the pivot's position
         assert(activeColumns.size() == 1);
         if (activeColumns[0] != pivotIndex) {
-            swapColumns(A, activeColumns[0], pivotIndex, U);
+            swapColumns(A, activeColumns[0], pivotIndex, U, log);
         }
         return true;
     }
 
-    void reduceToTheLeft(SparseColMatrix & A, RowIndex rowIndex, ColIndex pivotIndex, SparseColMatrix & U) {
+    void reduceToTheLeft(SparseColMatrix & A, RowIndex rowIndex, ColIndex pivotIndex, SparseColMatrix & U, OperationLog * log = nullptr) {
         auto const & pivotCol = A[pivotIndex];
         assert(pivotCol.isFirst(rowIndex));
         auto const & pivotVal = pivotCol.getFirstCoeff();
@@ -134,7 +148,7 @@ namespace {
             if (not otherVal) { continue; }
             auto quotient = -fastrat_fdiv_q(*otherVal, pivotVal);
             if (not quotient.isZero()) {
-                addColumnMultiple(A, pivotIndex, quotient, ColIndex{col}, U);
+                addColumnMultiple(A, pivotIndex, quotient, ColIndex{col}, U, log);
             }
         }
     }
@@ -165,4 +179,94 @@ HermiteNormalForm::operator()(SparseColMatrix && A) const {
         ++pivotCol;
     }
     return {std::move(UT), pivotCol};
-}
\ No newline at end of file
+}
+void IncrementalHermiteNormalForm::addRow(SparseColMatrix::TermVec const & row, uint32_t colCount) {
+    assert(colCount >= A.colCount());
+    uint32_t rowIndex = rows.size();
+    rows.push_back({log.size(), A.colCount(), dimension});
+    while (A.colCount() < colCount) {
+        // A new column is zero in the rows above and does not take part in their operations
+        uint32_t col = A.colCount();
+        A.addColumn({});
+        SparseColMatrix::ColumnPolynomial unit;
+        unit.addTerm(IndexType{col}, 1);
+        UT.addRow();
+        UT.addColumn(std::move(unit));
+    }
+    // Bring the new row to the form of the rows above by replaying their operations on it
+    rowValues.assign(colCount, 0);
+    for (auto const & [col, coeff] : row) {
+        assert(col.x < colCount);
+        rowValues[col.x] = coeff;
+    }
+    for (auto const & op : log) {
+        switch (op.kind) {
+            case ColumnOperation::Kind::Negate:
+                rowValues[op.first].negate();
+                break;
+            case ColumnOperation::Kind::Swap:
+                std::swap(rowValues[op.first], rowValues[op.second]);
+                break;
+            case ColumnOperation::Kind::AddMultiple:
+                if (not rowValues[op.first].isZero()) {
+                    addProductAssign(rowValues[op.second], op.multiple, rowValues[op.first]);
+                }
+                break;
+        }
+    }
+    A.addRow();
+    for (uint32_t col = 0; col < colCount; ++col) {
+        if (not rowValues[col].isZero()) {
+            A[col].addTerm(RowIndex{rowIndex}, std::move(rowValues[col]));
+        }
+    }
+    // Continue the computation of HermiteNormalForm with the new row
+    bool hasPivot = normalizeRow(A, RowIndex{rowIndex}, ColIndex{dimension}, UT, &log);
+    if (hasPivot) {
+        reduceToTheLeft(A, RowIndex{rowIndex}, ColIndex{dimension}, UT, &log);
+        ++dimension;
+    }
+}
+
+void IncrementalHermiteNormalForm::removeRows(uint32_t count) {
+    assert(count <= rows.size());
+    for (; count > 0; --count) {
+        RowRecord const & record = rows.back();
+        uint32_t rowIndex = rows.size() - 1;
+        // The operations of a row do not change the rows above it, undoing them restores the previous state
+        for (std::size_t i = log.size(); i > record.logSize; --i) {
+            auto const & op = log[i - 1];
+            switch (op.kind) {
+                case ColumnOperation::Kind::Negate:
+                    negateColumn(A, ColIndex{op.first}, UT);
+                    break;
+                case ColumnOperation::Kind::Swap:
+                    swapColumns(A, ColIndex{op.first}, ColIndex{op.second}, UT);
+                    break;
+                case ColumnOperation::Kind::AddMultiple:
+                    addColumnMultiple(A, ColIndex{op.first}, -op.multiple, ColIndex{op.second}, UT);
+                    break;
+            }
+        }
+        log.resize(record.logSize);
+        for (uint32_t col = 0; col < A.colCount(); ++col) {
+            A[col].removeTerm(RowIndex{rowIndex});
+        }
+        A.removeLastRow();
+        while (A.colCount() > record.colCount) {
+            A.removeLastColumn();
+            UT.removeLastColumn();
+            UT.removeLastRow();
+        }
+        dimension = record.dimension;
+        rows.pop_back();
+    }
+}
+
+void IncrementalHermiteNormalForm::clear() {
+    A = SparseColMatrix(RowCount{0}, ColumnCount{0});
+    UT = SparseColMatrix(RowCount{0}, ColumnCount{0});
+    log.clear();
+    rows.clear();
+    dimension = 0;
+}
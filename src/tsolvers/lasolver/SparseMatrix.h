@@ -53,6 +53,9 @@ public:
 
         uint32_t size() const { return poly.size(); }
 
+        void addTerm(RowIndex row, FastRational coeff) { poly.addTerm(IndexType{row.count}, std::move(coeff)); }
+        void removeTerm(RowIndex row);
+
         void negate();
         void add(Col const & other, FastRational const & multiple);
 
@@ -80,6 +83,7 @@ public:
 
     SparseColMatrix(SparseColMatrix const &) = delete;
     SparseColMatrix(SparseColMatrix &&) = default;
+    SparseColMatrix & operator=(SparseColMatrix &&) = default;
 
     Col &       operator[](uint32_t index)       { return cols[colPermutation[index]]; }
     Col const & operator[](uint32_t index) const { return cols[colPermutation[index]]; }
@@ -93,6 +97,21 @@ public:
         assert(colIndex < _colCount);
         cols[colIndex].setPolynomial(std::move(poly));
     }
+
+    void addRow() { ++_rowCount.count; }
+    void removeLastRow() { assert(_rowCount > 0); --_rowCount.count; }
+    void addColumn(ColumnPolynomial && poly) {
+        cols.emplace_back();
+        cols.back().setPolynomial(std::move(poly));
+        colPermutation.push_back(_colCount.count++);
+    }
+    // The last column can only be removed when it is not permuted
+    void removeLastColumn() {
+        assert(_colCount > 0 and colPermutation.back() == _colCount - 1);
+        cols.pop_back();
+        colPermutation.pop_back();
+        --_colCount.count;
+    }
 };
 
 class HermiteNormalForm {
@@ -104,6 +123,52 @@ public:
     HNFOperationsResult operator() (SparseColMatrix &&) const;
 };
 
+/*
+ * Hermite normal form of a matrix that is built row by row.
+ * Rows are added to and removed from the bottom of the matrix.  The column operations performed for each row are
+ * recorded, so that a new row is brought to the form of the rows above it by replaying them, and a removed row is
+ * taken back by undoing them.  The result is the same as that of HermiteNormalForm applied to the current matrix.
+ */
+class IncrementalHermiteNormalForm {
+public:
+    struct ColumnOperation {
+        enum class Kind : char { Negate, Swap, AddMultiple };
+        Kind kind;
+        uint32_t first;
+        uint32_t second;
+        FastRational multiple; // Only for AddMultiple: column second += multiple * column first
+    };
+    using OperationLog = std::vector<ColumnOperation>;
+
+    uint32_t rowCount() const { return rows.size(); }
+    uint32_t colCount() const { return A.colCount(); }
+
+    // Adds a row with the given (column, coefficient) terms; the matrix is first extended to colCount columns
+    void addRow(SparseColMatrix::TermVec const & row, uint32_t colCount);
+    // Removes the last count rows and the columns added together with them
+    void removeRows(uint32_t count);
+    void clear();
+
+    // The transpose of the matrix of the inverse operations, see HermiteNormalForm
+    SparseColMatrix const & getOperations() const { return UT; }
+    uint32_t getDimension() const { return dimension; }
+    // The number of operations recorded for the first count rows
+    std::size_t operationCount(uint32_t count) const { return count < rows.size() ? rows[count].logSize : log.size(); }
+
+private:
+    struct RowRecord {
+        std::size_t logSize;
+        uint32_t colCount;
+        uint32_t dimension;
+    };
+    SparseColMatrix A{RowCount{0}, ColumnCount{0}};
+    SparseColMatrix UT{RowCount{0}, ColumnCount{0}};
+    OperationLog log;
+    std::vector<RowRecord> rows;
+    uint32_t dimension = 0;
+    std::vector<FastRational> rowValues;
+};
+
 struct SparseLinearSystem {
     SparseColMatrix A;
     std::vector<FastRational> rhs;
@@ -27,15 +27,15 @@ void Tableau::nonbasicVar(LVRef v) {
 void Tableau::newNonbasicVar(LVRef v) {
     assert(!isProcessed(v));
     ensureTableauReadyFor(v);
-    assert(!cols[v.x]);
-    cols[v.x] = std::make_unique<Column>();
+    assert(cols[v.x].empty());
     varTypes[getVarId(v)] = VarType::NONBASIC;
 }
 
 void Tableau::newRow(LVRef v, std::unique_ptr<Polynomial> poly) {
     assert(!isProcessed(v));
     ensureTableauReadyFor(v);
-    addRow(v, std::move(poly));
+    assert(rows[v.x].size() == 0);
+    rows[v.x] = Row(std::move(*poly));
     varTypes[getVarId(v)] = VarType::QUASIBASIC;
     normalizeRow(v);
 
@@ -46,32 +46,26 @@ std::size_t Tableau::getNumOfCols() const {
 }
 
 std::size_t Tableau::getPolySize(LVRef basicVar) const {
-    assert(rows[basicVar.x]);
-    return rows[basicVar.x]->size();
+    return getRowPoly(basicVar).size();
 }
 
 const opensmt::Real & Tableau::getCoeff(LVRef basicVar, LVRef nonBasicVar) const {
-    assert(rows[basicVar.x]);
-    return rows[basicVar.x]->getCoeff(nonBasicVar);
+    return getRowPoly(basicVar).getCoeff(nonBasicVar);
 }
 
 const Tableau::column_t & Tableau::getColumn(LVRef nonBasicVar) const {
-    assert(cols[nonBasicVar.x]);
-    return *cols[nonBasicVar.x];
+    assert(isNonBasic(nonBasicVar));
+    return cols[nonBasicVar.x];
 }
 
-const Tableau::Polynomial & Tableau::getRowPoly(LVRef basicVar) const {
-    assert(rows[basicVar.x]);
-    return *rows[basicVar.x];
+const Tableau::Row & Tableau::getRowPoly(LVRef basicVar) const {
+    assert(isBasic(basicVar) or isQuasiBasic(basicVar));
+    return rows[basicVar.x];
 }
 
-Tableau::Polynomial & Tableau::getRowPoly(LVRef basicVar) {
-    assert(rows[basicVar.x]);
-    return *rows[basicVar.x];
-}
-
-const Tableau::rows_t & Tableau::getRows() const {
-    return rows;
+Tableau::Row & Tableau::getRow(LVRef basicVar) {
+    assert(isBasic(basicVar) or isQuasiBasic(basicVar));
+    return rows[basicVar.x];
 }
 
 std::vector<LVRef> Tableau::getNonBasicVars() const {
@@ -85,29 +79,16 @@ std::vector<LVRef> Tableau::getNonBasicVars() const {
     return res;
 }
 
-void Tableau::addRow(LVRef v, std::unique_ptr<Polynomial> p) {
-    assert(!rows[v.x]);
-    rows[v.x] = std::move(p);
-}
-
-std::unique_ptr<Tableau::Polynomial> Tableau::removeRow(LVRef v) {
-    assert(rows[v.x]);
-    std::unique_ptr<Polynomial> res;
-    assert(!res);
-    res.swap(rows[v.x]);
-    return res;
-}
-
 void Tableau::moveRowFromTo(LVRef from, LVRef to) {
-    assert(!rows[to.x]);
-    assert(rows[from.x]);
+    assert(rows[to.x].size() == 0);
     rows[to.x] = std::move(rows[from.x]);
+    rows[from.x].clear();
 }
 
 void Tableau::moveColFromTo(LVRef from, LVRef to) {
-    assert(!cols[to.x]);
-    assert(cols[from.x]);
+    assert(cols[to.x].empty());
     cols[to.x] = std::move(cols[from.x]);
+    cols[from.x].clear();
 }
 
 bool Tableau::isProcessed(LVRef v) const {
@@ -119,13 +100,11 @@ void Tableau::pivot(LVRef bv, LVRef nv) {
     assert(isNonBasic(nv));
     varTypes[getVarId(bv)] = VarType::NONBASIC;
     varTypes[getVarId(nv)] = VarType::BASIC;
-    assert(cols[nv.x]);
-    assert(!cols[bv.x]);
+    assert(cols[bv.x].empty());
+    assert(rows[nv.x].size() == 0);
     // compute the polynomial for nv
-    assert(rows[bv.x]);
-    assert(!rows[nv.x]);
     {
-        Polynomial & nvPoly = getRowPoly(bv);
+        Row & nvPoly = rows[bv.x];
         const auto coeff = nvPoly.removeVar(nv);
         if (not coeff.isOne()) {
             nvPoly.divideBy(coeff);
@@ -139,11 +118,9 @@ void Tableau::pivot(LVRef bv, LVRef nv) {
     // move the column from nv tto bv
     moveColFromTo(nv, bv);
 
-    Polynomial & nvPoly = getRowPoly(nv);
+    Row const & nvPoly = getRowPoly(nv);
     // update column information regarding this one poly
-    for(auto & term : nvPoly) {
-        auto var = term.var;
-        assert(cols[var.x]);
+    for (LVRef var : nvPoly.getVars()) {
         removeRowFromColumn(bv, var);
         addRowToColumn(nv, var);
     }
@@ -154,28 +131,24 @@ void Tableau::pivot(LVRef bv, LVRef nv) {
             continue;
         }
         // update the polynomials
-        auto & poly = getRowPoly(rowVar);
+        auto & poly = getRow(rowVar);
         const auto nvCoeff = poly.removeVar(nv);
-        poly.merge(nvPoly, nvCoeff, tmp_storage,
+        poly.merge(nvPoly, nvCoeff, mergeProducts, coeffOpStats,
                 // informAdded
                    [this, bv, rowVar](LVRef addedVar) {
                        if (addedVar == bv) { return; }
-                       assert(cols[addedVar.x]);
                        assert(!contains(getColumn(addedVar), rowVar));
                        addRowToColumn(rowVar, addedVar);
                    },
                 // informRemoved
                    [this, rowVar](LVRef removedVar) {
-                       assert(cols[removedVar.x]);
                        assert(contains(getColumn(removedVar), rowVar));
                        removeRowFromColumn(rowVar, removedVar);
                    }
         );
     }
-    assert(!cols[nv.x]);
-    assert(cols[bv.x]);
-    assert(!rows[bv.x]);
-    assert(rows[nv.x]);
+    assert(cols[nv.x].empty());
+    assert(rows[bv.x].size() == 0);
 }
 
 void Tableau::clear() {
@@ -194,7 +167,7 @@ bool Tableau::isQuasiBasic(LVRef v) const
 void Tableau::print() const {
     std::cout << "Rows:\n";
     for(unsigned i = 0; i != rows.size(); ++i) {
-        if (!rows[i]) { continue; }
+        if (!isBasic(LVRef{i}) and !isQuasiBasic(LVRef{i})) { continue; }
         std::cout << "Var of the row: " << i << ';';
         for (const auto & term : this->getRowPoly(LVRef{i})) {
             std::cout << "( " << term.coeff << " | " << term.var.x << " ) ";
@@ -204,7 +177,7 @@ void Tableau::print() const {
     std::cout << '\n';
     std::cout << "Columns:\n";
     for(unsigned i = 0; i != cols.size(); ++i) {
-        if(!cols[i]) { continue; }
+        if(!isNonBasic(LVRef{i})) { continue; }
         std::cout << "Var of the column: " << i << "; Contains: ";
         for (auto var : getColumn(LVRef{i})) {
             std::cout << var.x << ' ';
@@ -219,15 +192,14 @@ bool Tableau::checkConsistency() const {
     for(unsigned i = 0; i < cols.size(); ++i) {
         LVRef var {i};
         if (isNonBasic(var)) {
-            res &= (cols[i] != nullptr);
-            assert(res);
-            for(auto row : *cols[i]) {
+            for(auto row : cols[i]) {
                 res &= this->getRowPoly(row).contains(var);
                 assert(res);
             }
         }
         else{
-            assert(!cols[i]);
+            res &= cols[i].empty();
+            assert(res);
         }
     }
 
@@ -236,12 +208,10 @@ bool Tableau::checkConsistency() const {
         if(isQuasiBasic(var)) {
             continue;
         }
-        if (!rows[i]) { assert(isNonBasic(var)); continue; }
-        res &= isBasic(var);
-        assert(res);
-        for (auto const & term : *rows[i]) {
+        if (!isBasic(var)) { continue; }
+        for (auto const & term : rows[i]) {
             auto termVar = term.var;
-            res &= isNonBasic(termVar) && cols[termVar.x];
+            res &= isNonBasic(termVar);
             assert(res);
             res &= contains(getColumn(termVar), var);
             assert(res);
@@ -253,7 +223,7 @@ bool Tableau::checkConsistency() const {
 // Makes sures the representing polynomial of this row contains only nonbasic variables
 void Tableau::normalizeRow(LVRef v) {
     assert(isQuasiBasic(v)); // Do not call this for non quasi rows
-    Polynomial & row = getRowPoly(v);
+    Row & row = getRow(v);
     std::vector<LVRef> toEliminate;
     for (auto const & term : row) {
         if (isQuasiBasic(term.var)) {
@@ -266,7 +236,7 @@ void Tableau::normalizeRow(LVRef v) {
     }
     for (LVRef var : toEliminate) {
         auto const coeff = row.removeVar(var);
-        row.merge(getRowPoly(var), coeff, tmp_storage);
+        row.merge(getRowPoly(var), coeff, mergeProducts, coeffOpStats);
     }
 }
 
@@ -274,8 +244,8 @@ void Tableau::normalizeRow(LVRef v) {
 void Tableau::quasiToBasic(LVRef v) {
     assert(isQuasiBasic(v));
     normalizeRow(v);
-    for (auto const & term : getRowPoly(v)) {
-        addRowToColumn(v, term.var);
+    for (LVRef var : getRowPoly(v).getVars()) {
+        addRowToColumn(v, var);
     }
     varTypes[getVarId(v)] = VarType::BASIC;
     assert(isBasic(v));
@@ -287,10 +257,9 @@ void Tableau::basicToQuasi(LVRef v) {
     varTypes[getVarId(v)] = VarType::QUASIBASIC;
     assert(isQuasiBasic(v));
 
-    Polynomial & row = getRowPoly(v);
-    for (auto & term : row) {
-        assert(isNonBasic(term.var));
-        removeRowFromColumn(v, term.var);
+    for (LVRef var : getRowPoly(v).getVars()) {
+        assert(isNonBasic(var));
+        removeRowFromColumn(v, var);
     }
     simplex_assert(checkConsistency());
 }
@@ -7,6 +7,7 @@
 
 
 #include "Polynomial.h"
+#include "TableauRow.h"
 #include "LAVar.h"
 #include "Real.h"
 
@@ -59,11 +60,11 @@ class Tableau{
 
 public:
     using Polynomial = PolynomialT<LVRef>;
+    using Row = TableauRow;
 protected:
 
     // using column_t = std::unordered_set<LVRef, LVRefHash>;
     using column_t = Column;
-    using rows_t = std::vector<std::unique_ptr<Polynomial>>;
 //    using vars_t = std::unordered_set<LVRef, LVRefHash>;
     using vars_t = std::set<LVRef, LVRefComp>;
 
@@ -76,9 +77,7 @@ public:
     std::size_t getPolySize(LVRef basicVar) const;
     const opensmt::Real & getCoeff(LVRef basicVar, LVRef nonBasicVar) const;
     const column_t & getColumn(LVRef nonBasicVar) const;
-    const Polynomial & getRowPoly(LVRef basicVar) const;
-    Polynomial & getRowPoly(LVRef basicVar);
-    const rows_t & getRows() const;
+    const Row & getRowPoly(LVRef basicVar) const;
 
     void clear();
     void pivot(LVRef bv, LVRef nv);
@@ -91,31 +90,34 @@ public:
     void quasiToBasic(LVRef v);
     void basicToQuasi(LVRef v);
 
+    Row::CoeffOpStats const & getCoeffOpStats() const { return coeffOpStats; }
+
     // debug
     void print() const;
     bool checkConsistency() const;
     std::vector<LVRef> getNonBasicVars() const;
 
 private:
-    std::vector<std::unique_ptr<column_t>> cols;
-    rows_t rows;
+    // Rows and columns are stored by value, indexed by the variable id; only the entries of the variables of the
+    // appropriate type (see varTypes) are meaningful
+    std::vector<column_t> cols;
+    std::vector<Row> rows;
 
     enum class VarType:char {
         NONE, BASIC, NONBASIC, QUASIBASIC
     };
     std::vector<VarType> varTypes;
 
-    Tableau::Polynomial::poly_t tmp_storage;
+    Row::CoeffOpStats coeffOpStats;
+    std::vector<int64_t> mergeProducts; // Temporary storage for merging rows
 
     void ensureTableauReadyFor(LVRef v);
 
-    void addRow(LVRef v, std::unique_ptr<Polynomial> p);
-    std::unique_ptr<Polynomial> removeRow(LVRef v);
+    Row & getRow(LVRef basicVar);
     void moveRowFromTo(LVRef from, LVRef to);
     void moveColFromTo(LVRef from, LVRef to);
-    void addRowToColumn(LVRef row, LVRef col) { assert(cols[col.x]); cols[col.x]->addRow(row); }
-    void removeRowFromColumn(LVRef row, LVRef col) { assert(cols[col.x]); cols[col.x]->removeRow(row); }
-    void clearColumn(LVRef col) { assert(cols[col.x]); cols[col.x]->clear();}
+    void addRowToColumn(LVRef row, LVRef col) { assert(isNonBasic(col)); cols[col.x].addRow(row); }
+    void removeRowFromColumn(LVRef row, LVRef col) { assert(isNonBasic(col)); cols[col.x].removeRow(row); }
     void normalizeRow(LVRef row);
 };
 
@@ -0,0 +1,214 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+
+#ifndef OPENSMT_TABLEAUROW_H
+#define OPENSMT_TABLEAUROW_H
+
+#include "LARefs.h"
+#include "Polynomial.h"
+#include "Real.h"
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+
+/*
+ * Compressed sparse row of the simplex tableau.
+ *
+ * Variables and coefficients are kept in two parallel arrays, both ordered by variable id.
+ * Operations that only need the variables of a row (lookups, column bookkeeping, computing the shape of a merge)
+ * therefore scan a dense array of 32-bit ids and never touch the coefficients.
+ * Merging another row into this one is done in place, from the back, so no temporary storage is needed.
+ */
+class TableauRow {
+    std::vector<LVRef> vars;
+    std::vector<opensmt::Real> coeffs;
+
+    std::size_t indexOf(LVRef var) const {
+        auto it = std::lower_bound(vars.begin(), vars.end(), var, LVRefComp{});
+        return it != vars.end() and *it == var ? it - vars.begin() : vars.size();
+    }
+
+public:
+    // Counts how the coefficient updates of merges were computed: in machine words or with general rationals
+    struct CoeffOpStats {
+        uint64_t wordOps = 0;
+        uint64_t rationalOps = 0;
+    };
+
+    struct TermRef {
+        LVRef var;
+        opensmt::Real const & coeff;
+    };
+
+    class const_iterator {
+        TableauRow const * row;
+        std::size_t index;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = TermRef;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = TermRef;
+
+        const_iterator(TableauRow const * row, std::size_t index) : row(row), index(index) {}
+        TermRef operator*() const { return {row->vars[index], row->coeffs[index]}; }
+        const_iterator & operator++() { ++index; return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++index; return tmp; }
+        bool operator==(const_iterator const & o) const { return index == o.index; }
+        bool operator!=(const_iterator const & o) const { return index != o.index; }
+    };
+
+    TableauRow() = default;
+    explicit TableauRow(PolynomialT<LVRef> && poly);
+
+    std::size_t size() const { return vars.size(); }
+    bool contains(LVRef var) const { return indexOf(var) != vars.size(); }
+    opensmt::Real const & getCoeff(LVRef var) const { assert(contains(var)); return coeffs[indexOf(var)]; }
+    std::vector<LVRef> const & getVars() const { return vars; }
+
+    void addTerm(LVRef var, opensmt::Real coeff);
+    opensmt::Real removeVar(LVRef var);
+    void negate();
+    void divideBy(opensmt::Real const & r);
+    void clear() { vars.clear(); coeffs.clear(); }
+
+    // this += coeff * other; the hooks are informed about variables that enter or leave this row.
+    // If coeff and all coefficients of other are integers, the products are computed for the whole row at once into
+    // the external storage `products`, and only the few terms whose result leaves the word range take the general path.
+    template<typename ADD, typename REM>
+    void merge(TableauRow const & other, opensmt::Real const & coeff, std::vector<int64_t> & products, CoeffOpStats & stats,
+               ADD informAdded, REM informRemoved);
+    void merge(TableauRow const & other, opensmt::Real const & coeff, std::vector<int64_t> & products, CoeffOpStats & stats) {
+        merge(other, coeff, products, stats, [](LVRef){}, [](LVRef){});
+    }
+
+    const_iterator begin() const { return {this, 0}; }
+    const_iterator end() const { return {this, vars.size()}; }
+};
+
+inline TableauRow::TableauRow(PolynomialT<LVRef> && poly) {
+    vars.reserve(poly.size());
+    coeffs.reserve(poly.size());
+    for (auto & term : poly) {
+        vars.push_back(term.var);
+        coeffs.push_back(std::move(term.coeff));
+    }
+    assert(std::is_sorted(vars.begin(), vars.end(), LVRefComp{}));
+}
+
+inline void TableauRow::addTerm(LVRef var, opensmt::Real coeff) {
+    assert(not contains(var));
+    auto pos = std::upper_bound(vars.begin(), vars.end(), var, LVRefComp{}) - vars.begin();
+    vars.insert(vars.begin() + pos, var);
+    coeffs.insert(coeffs.begin() + pos, std::move(coeff));
+}
+
+inline opensmt::Real TableauRow::removeVar(LVRef var) {
+    assert(contains(var));
+    auto pos = indexOf(var);
+    opensmt::Real coeff = std::move(coeffs[pos]);
+    vars.erase(vars.begin() + pos);
+    coeffs.erase(coeffs.begin() + pos);
+    return coeff;
+}
+
+inline void TableauRow::negate() {
+    for (auto & coeff : coeffs) {
+        coeff.negate();
+    }
+}
+
+inline void TableauRow::divideBy(opensmt::Real const & r) {
+    for (auto & coeff : coeffs) {
+        coeff /= r;
+    }
+}
+
+template<typename ADD, typename REM>
+void TableauRow::merge(TableauRow const & other, opensmt::Real const & coeff, std::vector<int64_t> & products,
+                       CoeffOpStats & stats, ADD informAdded, REM informRemoved) {
+    std::size_t const mySize = vars.size();
+    std::size_t const otherSize = other.vars.size();
+    if (products.size() < otherSize) {
+        products.resize(otherSize);
+    }
+    bool const integerProductsValid = integerProducts(other.coeffs.data(), otherSize, coeff, products.data());
+    // Compute the number of distinct variables of the result; this only reads the ids
+    std::size_t unionSize = mySize + otherSize;
+    for (std::size_t i = 0, j = 0; i < mySize and j < otherSize;) {
+        if (vars[i].x < other.vars[j].x) { ++i; }
+        else if (other.vars[j].x < vars[i].x) { ++j; }
+        else { --unionSize; ++i; ++j; }
+    }
+    vars.resize(unionSize, LVRef::Undef);
+    coeffs.resize(unionSize);
+    // Merge from the back. The write position never goes below the read position in this row, so the terms that
+    // still need to be read are never overwritten. Terms whose coefficient cancels out leave a gap.
+    std::size_t write = unionSize;
+    std::size_t i = mySize;
+    std::size_t j = otherSize;
+    while (j > 0) {
+        if (i > 0 and other.vars[j - 1].x < vars[i - 1].x) {
+            --i;
+            --write;
+            if (write != i) {
+                vars[write] = vars[i];
+                coeffs[write] = std::move(coeffs[i]);
+            }
+        } else if (i > 0 and other.vars[j - 1] == vars[i - 1]) {
+            --i;
+            --j;
+            if ((integerProductsValid and addIntegerAssign(coeffs[i], products[j])) or addProductAssign(coeffs[i], other.coeffs[j], coeff)) {
+                ++stats.wordOps;
+            } else {
+                ++stats.rationalOps;
+            }
+            if (coeffs[i].isZero()) {
+                informRemoved(vars[i]);
+            } else {
+                --write;
+                if (write != i) {
+                    vars[write] = vars[i];
+                    coeffs[write] = std::move(coeffs[i]);
+                }
+            }
+        } else {
+            --j;
+            --write;
+            vars[write] = other.vars[j];
+            if (integerProductsValid and assignInteger(coeffs[write], products[j])) {
+                ++stats.wordOps;
+                informAdded(other.vars[j]);
+                continue;
+            }
+            multiplication(coeffs[write], other.coeffs[j], coeff);
+            if (other.coeffs[j].wordPartValid() and coeff.wordPartValid() and coeffs[write].wordPartValid()) {
+                ++stats.wordOps;
+            } else {
+                ++stats.rationalOps;
+            }
+            informAdded(other.vars[j]);
+        }
+    }
+    // Terms [0, i) are untouched; if some coefficients cancelled out, close the gap between them and the merged suffix
+    assert(write >= i);
+    if (write > i) {
+        std::size_t const gap = write - i;
+        for (std::size_t k = write; k < unionSize; ++k) {
+            vars[k - gap] = vars[k];
+            coeffs[k - gap] = std::move(coeffs[k]);
+        }
+        vars.resize(unionSize - gap);
+        coeffs.resize(unionSize - gap);
+        // Do not keep around a lot of free capacity, it blows up the memory for large tableaux
+        if (coeffs.capacity() > 2 * coeffs.size()) {
+            std::vector<LVRef>(vars.begin(), vars.end()).swap(vars);
+            std::vector<opensmt::Real>(std::make_move_iterator(coeffs.begin()), std::make_move_iterator(coeffs.end())).swap(coeffs);
+        }
+    }
+    assert(std::is_sorted(vars.begin(), vars.end(), LVRefComp{}));
+}
+
+#endif //OPENSMT_TABLEAUROW_H
@@ -29,3 +29,31 @@ TEST_F(BoundTest, test_LABounds) {
         bs.clear();
     }
 }
+
+TEST_F(BoundTest, test_BoundsOfType) {
+    LAVarStore vs;
+    LABoundStore bs(vs);
+    LVRef x = vs.getNewVar();
+    // x <= 2, x <= 0, and later x < 1
+    LABoundStore::BoundInfo leq2 = bs.allocBoundPair(x, { Delta(2), Delta(2, 1) });
+    LABoundStore::BoundInfo leq0 = bs.allocBoundPair(x, { Delta(0), Delta(0, 1) });
+    bs.buildBounds();
+    LABoundStore::BoundInfo lt1 = bs.allocBoundPair(x, { Delta(1, -1), Delta(1) });
+    bs.updateBound(lt1);
+
+    auto const & upper = bs.getBounds(x, bound_u);
+    auto const & lower = bs.getBounds(x, bound_l);
+    ASSERT_EQ(upper.size(), 3);
+    ASSERT_EQ(lower.size(), 3);
+    EXPECT_EQ(upper[0], leq0.ub);
+    EXPECT_EQ(upper[1], lt1.ub);
+    EXPECT_EQ(upper[2], leq2.ub);
+    EXPECT_EQ(lower[0], leq0.lb);
+    EXPECT_EQ(lower[1], lt1.lb);
+    EXPECT_EQ(lower[2], leq2.lb);
+
+    EXPECT_EQ(bs.firstBoundNotBelow(x, bound_u, Delta(1, -1)), 1);
+    EXPECT_EQ(bs.firstBoundAbove(x, bound_u, Delta(1, -1)), 2);
+    EXPECT_EQ(bs.firstBoundNotBelow(x, bound_l, Delta(3)), 3);
+    EXPECT_EQ(bs.firstBoundAbove(x, bound_l, Delta(-1)), 0);
+}
@@ -1,18 +1,46 @@
 #include <gtest/gtest.h>
 #include <lasolver/Delta.h>
+
 TEST(Delta_test, test_ops_in_Delta)
 {
-    Delta plus_infty(Delta::UPPER);
-    Delta minus_infty(Delta::LOWER);
-    ASSERT_EQ(plus_infty.isPlusInf(),         true);
-    ASSERT_EQ(minus_infty.isMinusInf(),       true);
-    ASSERT_EQ(minus_infty < plus_infty,   true);
-    ASSERT_EQ(minus_infty <= plus_infty,  true);
-    ASSERT_EQ(plus_infty > minus_infty,   true);
-    ASSERT_EQ(plus_infty >= minus_infty,  true);
-    ASSERT_EQ(!(plus_infty < minus_infty),  true);
-    ASSERT_EQ(!(plus_infty < minus_infty), true);
-    ASSERT_EQ(!(minus_infty > plus_infty),  true);
-    ASSERT_EQ(!(minus_infty >= plus_infty), true);
+    Delta a(1, -1);
+    Delta b(1);
+    ASSERT_TRUE(a < b);
+    ASSERT_TRUE(a <= b);
+    ASSERT_TRUE(b > a);
+    ASSERT_TRUE(b >= a);
+    ASSERT_TRUE(a < Real(1));
+    ASSERT_TRUE(Real(1) > a);
+    ASSERT_EQ(a + b, Delta(2, -1));
+    ASSERT_EQ(a - b, Delta(0, -1));
+    ASSERT_EQ(Real(3) * a, Delta(3, -3));
+    ASSERT_EQ(a / Real(2), Delta(Real(1, 2), Real(-1, 2)));
+}
+
+TEST(Delta_test, test_addScaled)
+{
+    Delta x(Real(1, 2), 1);
+    Delta diff(Real(1, 3), -1);
+    Real coeff(3, 2);
+    Delta expected = x + coeff * diff;
+    x.addScaled(diff, coeff);
+    ASSERT_EQ(x, expected);
+    ASSERT_EQ(x, Delta(1, Real(-1, 2)));
+    x.subScaled(diff, coeff);
+    ASSERT_EQ(x, Delta(Real(1, 2), 1));
 }
 
+TEST(Delta_test, test_addScaledBig)
+{
+    Real big = Real(INT_MAX) * Real(INT_MAX) * Real(INT_MAX);
+    Delta x(big, 0);
+    Delta diff(big, 1);
+    x.addScaled(diff, -1);
+    ASSERT_EQ(x, Delta(0, -1));
+    x.subScaled(diff, Real(1, 2));
+    ASSERT_EQ(x, Delta(big / -2, Real(-3, 2)));
+    x *= 2;
+    ASSERT_EQ(x, Delta(-big, -3));
+    x /= -3;
+    ASSERT_EQ(x, Delta(big / 3, 1));
+}
@@ -139,3 +139,35 @@ TEST_F(EgraphTest, test_IncrementalAddition) {
     ASSERT_TRUE(egraph.assertLit({eq3, l_True}));
     ASSERT_EQ(egraph.check(true), TRes::SAT);
 }
+
+TEST_F(EgraphTest, test_ExplainDeduction) {
+    SRef sref = logic.declareUninterpretedSort("U");
+    PTRef x = logic.mkVar(sref, "x");
+    PTRef y = logic.mkVar(sref, "y");
+    PTRef z = logic.mkVar(sref, "z");
+    PTRef xy = logic.mkEq(x, y);
+    PTRef yz = logic.mkEq(y, z);
+    PTRef xz = logic.mkEq(x, z);
+    egraph.declareAtom(xy);
+    egraph.declareAtom(yz);
+    egraph.declareAtom(xz);
+
+    egraph.pushBacktrackPoint();
+    ASSERT_TRUE(egraph.assertLit({xy, l_True}));
+    egraph.pushBacktrackPoint();
+    ASSERT_TRUE(egraph.assertLit({yz, l_True}));
+    // x = y and y = z imply x = z
+    PtAsgn_reason deduced = egraph.getDeduction();
+    ASSERT_EQ(deduced.tr, xz);
+    ASSERT_EQ(deduced.sgn, l_True);
+    std::size_t index = egraph.lastDeductionIndex();
+
+    vec<PtAsgn> reason = egraph.explainDeduction(PtAsgn(xz, l_True), index);
+    ASSERT_EQ(reason.size(), 3);
+    EXPECT_TRUE(std::find(reason.begin(), reason.end(), PtAsgn(xy, l_True)) != reason.end());
+    EXPECT_TRUE(std::find(reason.begin(), reason.end(), PtAsgn(yz, l_True)) != reason.end());
+    EXPECT_TRUE(std::find(reason.begin(), reason.end(), PtAsgn(xz, l_False)) != reason.end());
+    // Building the explanation leaves the state of the solver as it was
+    EXPECT_EQ(egraph.getDeduction().tr, PTRef_Undef);
+    ASSERT_FALSE(egraph.assertLit({xz, l_False}));
+}
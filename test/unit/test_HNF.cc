@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <Vec.h>
 #include <lasolver/Matrix.h>
+#include <lasolver/SparseMatrix.h>
 
 class HNF_test : public ::testing::Test {
 protected:
@@ -318,4 +319,81 @@ TEST_F(HNF_test, test_hnf9) {
             ASSERT_EQ(ms.MM(H, i+1, j+1), hnf_ref[i][j]);
 }
 
+class IncrementalHNF_test : public ::testing::Test {
+protected:
+    using Row = std::vector<int>;
+
+    static SparseColMatrix::TermVec toTerms(Row const & row) {
+        SparseColMatrix::TermVec terms;
+        for (uint32_t col = 0; col < row.size(); ++col) {
+            if (row[col] != 0) { terms.emplace_back(IndexType{col}, row[col]); }
+        }
+        return terms;
+    }
+
+    static SparseColMatrix toMatrix(std::vector<Row> const & rows, uint32_t colCount) {
+        SparseColMatrix matrix(RowCount{static_cast<uint32_t>(rows.size())}, ColumnCount{colCount});
+        for (uint32_t col = 0; col < colCount; ++col) {
+            SparseColMatrix::ColumnPolynomial poly;
+            for (uint32_t row = 0; row < rows.size(); ++row) {
+                if (col < rows[row].size() and rows[row][col] != 0) { poly.addTerm(IndexType{row}, rows[row][col]); }
+            }
+            matrix.setColumn(ColIndex{col}, std::move(poly));
+        }
+        return matrix;
+    }
+
+    // Adds the rows with the columns they use, and checks the result against the HNF computed from scratch
+    void addRows(std::vector<Row> const & newRows) {
+        for (auto const & row : newRows) {
+            rows.push_back(row);
+            colCounts.push_back(std::max(colCounts.empty() ? 0u : colCounts.back(), static_cast<uint32_t>(row.size())));
+            hnf.addRow(toTerms(row), colCounts.back());
+        }
+        check();
+    }
+
+    void removeRows(uint32_t count) {
+        hnf.removeRows(count);
+        rows.resize(rows.size() - count);
+        colCounts.resize(colCounts.size() - count);
+        check();
+    }
 
+    void check() const {
+        uint32_t colCount = colCounts.empty() ? 0 : colCounts.back();
+        ASSERT_EQ(hnf.rowCount(), rows.size());
+        ASSERT_EQ(hnf.colCount(), colCount);
+        auto [operations, dimension] = HermiteNormalForm()(toMatrix(rows, colCount));
+        EXPECT_EQ(hnf.getDimension(), dimension);
+        for (uint32_t col = 0; col < colCount; ++col) {
+            EXPECT_EQ(hnf.getOperations()[col].toVector(), operations[col].toVector());
+        }
+    }
+
+    IncrementalHermiteNormalForm hnf;
+    std::vector<Row> rows;
+    std::vector<uint32_t> colCounts;
+};
+
+TEST_F(IncrementalHNF_test, test_AddRows) {
+    addRows({{0, -2, -6, 4}, {-1, 3, -1, -2}});
+    addRows({{1, 2, -2, -2}});
+    addRows({{0, 1, 0, 10, 3}, {5, 0, 0, 0, 7, 2}});
+    // A row dependent on the rows above
+    addRows({{1, 1, -3, 2}});
+}
+
+TEST_F(IncrementalHNF_test, test_RemoveRows) {
+    addRows({{2, 4, 0}, {0, 3, 6, 9}, {1, 0, 5, 0, 7}, {0, 0, 0, 0, 0, 11}});
+    removeRows(1);
+    removeRows(2);
+    addRows({{3, -5, 0, 0, 2}, {0, 6, 4}});
+    removeRows(3);
+    EXPECT_EQ(hnf.getDimension(), 0);
+    addRows({{4, 6}, {6, 9}});
+    hnf.clear();
+    rows.clear();
+    colCounts.clear();
+    check();
+}
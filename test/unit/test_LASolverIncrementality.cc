@@ -42,4 +42,77 @@ TEST_F(LASolverIncrementalityTest, test_Incrementality) {
     solver.assertLit({constr2, l_True});
     res = solver.check(true);
     ASSERT_EQ(res, TRes::UNSAT);
-}
\ No newline at end of file
+}
+TEST_F(LASolverIncrementalityTest, test_PopSeveralPointsAtOnce) {
+    PTRef x = logic.mkRealVar("x");
+    PTRef y = logic.mkRealVar("y");
+    PTRef one = logic.getTerm_RealOne();
+    // x + y <= 1, x >= 1, y >= 1
+    PTRef sum = logic.mkLeq(logic.mkPlus(x, y), one);
+    PTRef xLower = logic.mkGeq(x, one);
+    PTRef yLower = logic.mkGeq(y, one);
+    for (PTRef atom : {sum, xLower, yLower}) {
+        solver.declareAtom(atom);
+    }
+    solver.assertLit({sum, l_True});
+    ASSERT_EQ(solver.check(true), TRes::SAT);
+    solver.pushBacktrackPoint();
+    solver.assertLit({xLower, l_True});
+    ASSERT_EQ(solver.check(true), TRes::SAT);
+    solver.pushBacktrackPoint();
+    solver.assertLit({yLower, l_True});
+    ASSERT_EQ(solver.check(true), TRes::UNSAT);
+    solver.popBacktrackPoints(2);
+    ASSERT_EQ(solver.check(true), TRes::SAT);
+    // Both bounds are gone, y >= 1 alone is consistent with the sum
+    solver.pushBacktrackPoint();
+    solver.assertLit({yLower, l_True});
+    EXPECT_EQ(solver.check(true), TRes::SAT);
+    solver.pushBacktrackPoint();
+    solver.assertLit({xLower, l_True});
+    EXPECT_EQ(solver.check(true), TRes::UNSAT);
+}
+
+class LASolverRowDeductionTest : public ::testing::Test {
+    static SMTConfig & withRowDeductions(SMTConfig & config) {
+        config.lra_poly_deduct_size = 10;
+        return config;
+    }
+public:
+    LASolverRowDeductionTest() : logic(opensmt::Logic_t::QF_LRA), solver(withRowDeductions(c), logic) {}
+    SMTConfig c;
+    ArithLogic logic;
+    LASolver solver;
+};
+
+TEST_F(LASolverRowDeductionTest, test_DeductionFromRow) {
+    PTRef x = logic.mkRealVar("x");
+    PTRef y = logic.mkRealVar("y");
+    PTRef one = logic.getTerm_RealOne();
+    PTRef xGeq1 = logic.mkGeq(x, one);
+    PTRef yGeq1 = logic.mkGeq(y, one);
+    PTRef sumGeq1 = logic.mkGeq(logic.mkPlus(x, y), one);
+    solver.declareAtom(xGeq1);
+    solver.declareAtom(yGeq1);
+    solver.declareAtom(sumGeq1);
+
+    solver.pushBacktrackPoint();
+    ASSERT_TRUE(solver.assertLit({xGeq1, l_True}));
+    ASSERT_TRUE(solver.assertLit({yGeq1, l_True}));
+    // x >= 1 and y >= 1 imply x + y >= 1
+    PtAsgn_reason deduced = solver.getDeduction();
+    ASSERT_EQ(deduced.tr, sumGeq1);
+    ASSERT_EQ(deduced.sgn, l_True);
+    EXPECT_EQ(solver.getDeduction().tr, PTRef_Undef);
+
+    vec<PtAsgn> reason = solver.getReasonFor(PtAsgn(sumGeq1, l_True));
+    ASSERT_EQ(reason.size(), 3);
+    EXPECT_TRUE(std::find(reason.begin(), reason.end(), PtAsgn(xGeq1, l_True)) != reason.end());
+    EXPECT_TRUE(std::find(reason.begin(), reason.end(), PtAsgn(yGeq1, l_True)) != reason.end());
+    EXPECT_TRUE(std::find(reason.begin(), reason.end(), PtAsgn(sumGeq1, l_False)) != reason.end());
+
+    solver.popBacktrackPoint();
+    // Without the bound on y nothing follows for the sum
+    ASSERT_TRUE(solver.assertLit({xGeq1, l_True}));
+    EXPECT_EQ(solver.getDeduction().tr, PTRef_Undef);
+}
@@ -6,6 +6,7 @@
 #include <SMTConfig.h>
 #include <lasolver/Simplex.h>
 #include <lasolver/LASolver.h>
+#include <lasolver/CutCreator.h>
 
 using Polynomial = PolynomialT<LVRef>;
 
@@ -123,3 +124,105 @@ cout << sum.D() << endl;
 //4. ckeck simplex on Ax<b if Ax<b is UNSAT then AX<=b implies equality
 */
 
+
+TEST(LIACutSolver_test, test_makeCuts)
+{
+    // 2x = 1, 2y + 200z = 1, 3z = 1, where x = y = 1/2 and z = 1/3
+    PTRef x {0};
+    PTRef y {1};
+    PTRef z {2};
+    auto makeSystem = [] {
+        SparseColMatrix matrix(RowCount{3}, ColumnCount{3});
+        SparseColMatrix::ColumnPolynomial col0, col1, col2;
+        col0.addTerm(IndexType{0}, 2);
+        col1.addTerm(IndexType{1}, 2);
+        col2.addTerm(IndexType{1}, 200);
+        col2.addTerm(IndexType{2}, 3);
+        matrix.setColumn(ColIndex{0}, std::move(col0));
+        matrix.setColumn(ColIndex{1}, std::move(col1));
+        matrix.setColumn(ColIndex{2}, std::move(col2));
+        return SparseLinearSystem{std::move(matrix), {1, 1, 1}};
+    };
+    CutCreator cutCreator([&](PTRef var) { return var == z ? FastRational(1, 3) : FastRational(1, 2); });
+    CutCreator::ColumnMapping mapping {x, y, z};
+
+    CutCreator::CutStats stats;
+    auto all = cutCreator.makeCuts(makeSystem(), mapping, {10, 10, 1000}, stats);
+    EXPECT_EQ(all.size(), 3);
+    EXPECT_EQ(stats.candidates, 3);
+    EXPECT_FALSE(all[0].first.empty());
+    EXPECT_EQ(all[0].first, cutCreator.makeCut(makeSystem(), mapping).first);
+
+    stats = {};
+    auto limited = cutCreator.makeCuts(makeSystem(), mapping, {2, 10, 1000}, stats);
+    EXPECT_EQ(limited.size(), 2);
+
+    // The first cut is always taken, the others only if they pass the filters
+    stats = {};
+    auto sparse = cutCreator.makeCuts(makeSystem(), mapping, {10, 0, 1000}, stats);
+    EXPECT_EQ(sparse.size(), 1);
+    EXPECT_EQ(stats.tooDense, 2);
+
+    stats = {};
+    auto small = cutCreator.makeCuts(makeSystem(), mapping, {10, 10, 0}, stats);
+    EXPECT_EQ(small.size(), 1);
+    EXPECT_EQ(stats.tooLarge, 2);
+}
+
+TEST(LIACutSolver_test, test_makeCutsCached)
+{
+    // The rows 2x = 1, 2y + 200z = 1, 3z = 1 of test_makeCuts, identified by r0, r1, r2
+    PTRef x {0};
+    PTRef y {1};
+    PTRef z {2};
+    PTRef r0 {10};
+    PTRef r1 {11};
+    PTRef r2 {12};
+    auto rowTerms = [&](PTRef row) -> CutCreator::RowTerms {
+        if (row == r0) { return {{x, 2}}; }
+        if (row == r1) { return {{y, 2}, {z, 200}}; }
+        return {{z, 3}};
+    };
+    CutCreator cutCreator([&](PTRef var) { return var == z ? FastRational(1, 3) : FastRational(1, 2); });
+
+    CutCreator::CutStats stats;
+    auto cuts = cutCreator.makeCuts({r1, r2, r0}, rowTerms, {10, 10, 1000}, stats);
+    EXPECT_EQ(cuts.size(), 3);
+    EXPECT_EQ(stats.rowsAdded, 3);
+    EXPECT_EQ(cutCreator.getColumnMapping(), (CutCreator::ColumnMapping{y, z, x}));
+
+    // Unchanged rows are not processed again
+    stats = {};
+    auto again = cutCreator.makeCuts({r1, r2, r0}, rowTerms, {10, 10, 1000}, stats);
+    EXPECT_EQ(stats.rowsReused, 3);
+    EXPECT_EQ(stats.rowsAdded, 0);
+    ASSERT_EQ(again.size(), cuts.size());
+    for (std::size_t i = 0; i < cuts.size(); ++i) {
+        EXPECT_EQ(again[i].first, cuts[i].first);
+    }
+
+    // Removed rows are taken back, the rows before them are kept
+    stats = {};
+    cuts = cutCreator.makeCuts({r1, r2}, rowTerms, {10, 10, 1000}, stats);
+    EXPECT_EQ(stats.rowsReused, 2);
+    EXPECT_EQ(stats.rowsRemoved, 1);
+    EXPECT_EQ(stats.rowsAdded, 0);
+    EXPECT_EQ(cuts.size(), 2);
+    EXPECT_EQ(cutCreator.getColumnMapping(), (CutCreator::ColumnMapping{y, z}));
+
+    stats = {};
+    cuts = cutCreator.makeCuts({r1, r2, r0}, rowTerms, {10, 10, 1000}, stats);
+    EXPECT_EQ(stats.rowsReused, 2);
+    EXPECT_EQ(stats.rowsAdded, 1);
+    EXPECT_EQ(cuts.size(), 3);
+
+    // The cuts are those of the system built from scratch
+    stats = {};
+    auto uncached = CutCreator(
+        [&](PTRef var) { return var == z ? FastRational(1, 3) : FastRational(1, 2); }
+    ).makeCuts({r1, r2, r0}, rowTerms, {10, 10, 1000}, stats);
+    ASSERT_EQ(uncached.size(), cuts.size());
+    for (std::size_t i = 0; i < cuts.size(); ++i) {
+        EXPECT_EQ(uncached[i].first, cuts[i].first);
+    }
+}
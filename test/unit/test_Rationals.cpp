@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include <Vec.h>
 #include <Sort.h>
+#include <thread>
 
 using Real = opensmt::Real;
 
@@ -492,3 +493,117 @@ TEST(Rationals_test, testWordRepresentation_Inverse) {
     ASSERT_TRUE(a.wordPartValid());
 }
 
+
+TEST(Rationals_test, test_addProductAssign) {
+    {
+        FastRational a(3);
+        EXPECT_TRUE(addProductAssign(a, FastRational(-2), FastRational(5)));
+        EXPECT_EQ(a, -7);
+        EXPECT_TRUE(a.wordPartValid());
+    }
+    {
+        FastRational a(1, 6);
+        EXPECT_TRUE(addProductAssign(a, FastRational(3, 4), FastRational(2, 9)));
+        EXPECT_EQ(a, FastRational(1, 3));
+    }
+    {
+        FastRational a(1, 2);
+        EXPECT_TRUE(addProductAssign(a, FastRational(-1, 2), FastRational(1)));
+        EXPECT_EQ(a, 0);
+        EXPECT_TRUE(a.isZero());
+    }
+    {
+        FastRational a(5, 6);
+        EXPECT_TRUE(addProductAssign(a, FastRational(7, 10), FastRational(5, 21)));
+        EXPECT_EQ(a, 1);
+        EXPECT_TRUE(a.isInteger());
+    }
+    {
+        FastRational a(INT_MAX);
+        EXPECT_FALSE(addProductAssign(a, FastRational(INT_MAX), FastRational(2)));
+        EXPECT_EQ(a, FastRational(INT_MAX) * 3);
+        EXPECT_FALSE(addProductAssign(a, FastRational(INT_MAX), FastRational(-2)));
+        EXPECT_EQ(a, INT_MAX);
+        EXPECT_TRUE(a.wordPartValid());
+    }
+}
+
+TEST(Rationals_test, test_NegativeFractionConstructor) {
+    FastRational a(-6, 4);
+    EXPECT_TRUE(a.isWellFormed());
+    EXPECT_EQ(a, FastRational(-3, 2));
+    EXPECT_EQ(FastRational(-1000, 1000), -1);
+}
+
+TEST(Rationals_test, test_subProductAssign) {
+    {
+        FastRational a(3);
+        EXPECT_TRUE(subProductAssign(a, FastRational(-2), FastRational(5)));
+        EXPECT_EQ(a, 13);
+    }
+    {
+        FastRational a(1, 3);
+        EXPECT_TRUE(subProductAssign(a, FastRational(3, 4), FastRational(2, 9)));
+        EXPECT_EQ(a, FastRational(1, 6));
+    }
+    {
+        FastRational a(INT_MAX);
+        EXPECT_FALSE(subProductAssign(a, FastRational(INT_MAX), FastRational(-2)));
+        EXPECT_EQ(a, FastRational(INT_MAX) * 3);
+        EXPECT_FALSE(subProductAssign(a, FastRational(INT_MAX), FastRational(2)));
+        EXPECT_EQ(a, INT_MAX);
+        EXPECT_TRUE(a.wordPartValid());
+    }
+}
+
+TEST(Rationals_test, test_ValuesReleasedByOtherThreads) {
+    Real const big = Real(INT_MAX) * INT_MAX;
+    std::vector<Real> values;
+    std::thread producer([&values, &big]() {
+        for (int i = 0; i < 10000; ++i) {
+            values.push_back(big + i);
+        }
+    });
+    producer.join();
+    // The values now outlive the pool of the thread that allocated them
+    std::vector<std::thread> consumers;
+    for (int t = 0; t < 4; ++t) {
+        consumers.emplace_back([&values, &big, t]() {
+            uint64_t const before = Real::mpqAllocations();
+            std::vector<Real> mine(values.begin() + t * 2500, values.begin() + (t + 1) * 2500);
+            for (std::size_t i = 0; i < mine.size(); ++i) {
+                EXPECT_EQ(mine[i] - big, t * 2500 + static_cast<int>(i));
+            }
+            EXPECT_GE(Real::mpqAllocations() - before, mine.size());
+        });
+    }
+    for (auto & consumer : consumers) {
+        consumer.join();
+    }
+    values.clear();
+    EXPECT_EQ(big, Real(INT_MAX) * INT_MAX);
+}
+
+TEST(Rationals_test, test_integerProducts) {
+    std::vector<FastRational> values {3, -2, INT_MAX, INT_MIN};
+    std::vector<int64_t> products(values.size());
+    ASSERT_TRUE(integerProducts(values.data(), values.size(), FastRational(INT_MIN), products.data()));
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(FastRational(std::to_string(products[i]).c_str()), values[i] * INT_MIN);
+    }
+    EXPECT_FALSE(integerProducts(values.data(), values.size(), FastRational(1, 2), products.data()));
+    values.push_back(FastRational(1, 3));
+    EXPECT_FALSE(integerProducts(values.data(), values.size(), FastRational(2), products.data()));
+
+    FastRational a(INT_MAX - 1);
+    EXPECT_TRUE(addIntegerAssign(a, 1));
+    EXPECT_EQ(a, INT_MAX);
+    EXPECT_FALSE(addIntegerAssign(a, 1));
+    EXPECT_EQ(a, INT_MAX);
+    FastRational half(1, 2);
+    EXPECT_FALSE(addIntegerAssign(half, 1));
+    EXPECT_TRUE(assignInteger(half, -5));
+    EXPECT_EQ(half, -5);
+    EXPECT_FALSE(assignInteger(half, int64_t(INT_MAX) + 1));
+    EXPECT_EQ(half, -5);
+}
@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 #include "SolverTypes.h"
+#include "Heap.h"
 #include <numeric>
 
 class SATSolverTypesTest : public ::testing::Test {
@@ -24,4 +25,47 @@ TEST_F(SATSolverTypesTest, test_ClauseIterator) {
         ASSERT_EQ(l, v[i]);
         i++;
     }
-}
\ No newline at end of file
+}
+
+TEST_F(SATSolverTypesTest, test_LearntFlagsSurviveRelocation) {
+    vec<Lit> v;
+    for (int i = 0; i < 5; i++) {
+        v.push(mkLit(i, false));
+    }
+    CRef c = ca.alloc(v, {true, 3});
+    ASSERT_FALSE(ca[c].used());
+    ASSERT_FALSE(ca[c].vivified());
+    ca[c].setUsed(true);
+    ca[c].setVivified(true);
+    ca[c].activity() = 2.5;
+    ClauseAllocator to;
+    ca.reloc(c, to);
+    EXPECT_TRUE(to[c].learnt());
+    EXPECT_TRUE(to[c].used());
+    EXPECT_TRUE(to[c].vivified());
+    EXPECT_EQ(to[c].getGlue(), 3);
+    EXPECT_EQ(to[c].size(), 5);
+    EXPECT_EQ(to[c].activity(), 2.5);
+}
+
+TEST(HeapTest, test_RemoveKeepsOrder) {
+    struct Lt {
+        std::vector<int> const & key;
+        bool operator()(int x, int y) const { return key[x] < key[y]; }
+    };
+    std::vector<int> key {0, 10, 1, 11, 12, 13, 2};
+    Heap<Lt> heap(Lt{key});
+    for (int i = 0; i < static_cast<int>(key.size()); ++i) {
+        heap.insert(i);
+    }
+    // The last element of the heap (2) has to move up when it replaces one of the elements (12) below the root
+    heap.remove(4);
+    heap.remove(6);
+    ASSERT_FALSE(heap.inHeap(4));
+    ASSERT_FALSE(heap.inHeap(6));
+    std::vector<int> order;
+    while (not heap.empty()) {
+        order.push_back(heap.removeMin());
+    }
+    ASSERT_EQ(order, std::vector<int>({0, 2, 1, 3, 5}));
+}
@@ -157,3 +157,52 @@ TEST(Simplex_test, test_Assignment)
     EXPECT_GE(x_val, -5);
     EXPECT_EQ(x_val, -1 * y_val);
 }
+
+TEST(Simplex_test, test_SteepestEdge)
+{
+    LAVarStore vs;
+
+    LVRef x = vs.getNewVar();
+    LVRef y = vs.getNewVar();
+    LVRef x_plus_y = vs.getNewVar();
+    LVRef x_minus_y = vs.getNewVar();
+
+    LABoundStore bs(vs);
+
+    LABoundStore::BoundInfo x_nostrict_2 = bs.allocBoundPair(x, { Delta(2), Delta(2, 1) }); // x <= 2 and x > 2
+    LABoundStore::BoundInfo y_strict_1 = bs.allocBoundPair(y, { Delta(1, -1), Delta(1) }); // y < 1 and y >= 1
+    LABoundStore::BoundInfo x_plus_y_strict_2 = bs.allocBoundPair(x_plus_y, { Delta(2, -1), Delta(2) }); // x + y < 2 and x + y >= 2
+    LABoundStore::BoundInfo x_minus_y_strict_2 = bs.allocBoundPair(x_minus_y, { Delta(2, -1), Delta(2) }); // x - y < 2 and x - y >= 2
+
+    bs.buildBounds();
+
+    Simplex s(bs);
+    s.setPivotRule(lra_pivot_rule_steepest_edge);
+
+    s.newNonbasicVar(x);
+    s.newNonbasicVar(y);
+    auto p_x_plus_y = std::make_unique<PolynomialT<LVRef>>();
+    p_x_plus_y->addTerm(x, 1);
+    p_x_plus_y->addTerm(y, 1);
+    s.newRow(x_plus_y, std::move(p_x_plus_y));
+    auto p_x_minus_y = std::make_unique<PolynomialT<LVRef>>();
+    p_x_minus_y->addTerm(x, 1);
+    p_x_minus_y->addTerm(y, -1);
+    s.newRow(x_minus_y, std::move(p_x_minus_y));
+
+    s.initModel();
+    s.assertBoundOnVar(x_plus_y, x_plus_y_strict_2.lb);
+    s.assertBoundOnVar(x_minus_y, x_minus_y_strict_2.lb);
+    Simplex::Explanation ex = s.checkSimplex();
+    ASSERT_EQ(ex.size(), 0);
+    EXPECT_GE(s.getValuation(x_plus_y), Delta(2));
+    EXPECT_GE(s.getValuation(x_minus_y), Delta(2));
+    EXPECT_EQ(s.getValuation(x_plus_y), s.getValuation(x) + s.getValuation(y));
+    EXPECT_EQ(s.getValuation(x_minus_y), s.getValuation(x) - s.getValuation(y));
+
+    s.pushBacktrackPoint();
+    s.assertBoundOnVar(x, x_nostrict_2.ub);
+    s.assertBoundOnVar(y, y_strict_1.lb);
+    ex = s.checkSimplex();
+    ASSERT_EQ(ex.size(), 3); // x <= 2, y >= 1, x - y >= 2
+}
@@ -0,0 +1,178 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <lasolver/TableauRow.h>
+#include <lasolver/Tableau.h>
+
+class TableauRowTest : public ::testing::Test {
+protected:
+    TableauRow row1 {};
+    TableauRow row2 {};
+    std::vector<LVRef> added;
+    std::vector<LVRef> removed;
+    TableauRow::CoeffOpStats stats;
+    std::vector<int64_t> products;
+
+    void merge(opensmt::Real const & coeff) {
+        row1.merge(row2, coeff, products, stats, [this](LVRef v) { added.push_back(v); }, [this](LVRef v) { removed.push_back(v); });
+    }
+
+    static std::vector<LVRef> varsOf(TableauRow const & row) {
+        std::vector<LVRef> res;
+        for (auto const & term : row) { res.push_back(term.var); }
+        return res;
+    }
+};
+
+TEST_F(TableauRowTest, test_FromPolynomial) {
+    PolynomialT<LVRef> poly;
+    poly.addTerm(LVRef{7}, 2);
+    poly.addTerm(LVRef{3}, -1);
+    TableauRow row(std::move(poly));
+    ASSERT_EQ(row.size(), 2);
+    EXPECT_EQ(varsOf(row), std::vector<LVRef>({LVRef{3}, LVRef{7}}));
+    EXPECT_EQ(row.getCoeff(LVRef{3}), -1);
+    EXPECT_EQ(row.getCoeff(LVRef{7}), 2);
+}
+
+TEST_F(TableauRowTest, test_AddRemove) {
+    LVRef x {10};
+    LVRef y {5};
+    row1.addTerm(x, 1);
+    row1.addTerm(y, FastRational(1, 2));
+    EXPECT_EQ(varsOf(row1), std::vector<LVRef>({y, x}));
+    EXPECT_EQ(row1.removeVar(y), FastRational(1, 2));
+    EXPECT_FALSE(row1.contains(y));
+    EXPECT_TRUE(row1.contains(x));
+}
+
+TEST_F(TableauRowTest, test_MergeDisjoint) {
+    LVRef x1 {1};
+    LVRef x2 {4};
+    LVRef y1 {2};
+    LVRef y2 {6};
+    row1.addTerm(x1, 1);
+    row1.addTerm(x2, -1);
+    row2.addTerm(y1, -1);
+    row2.addTerm(y2, 1);
+    merge(3);
+    EXPECT_EQ(added.size(), 2);
+    EXPECT_TRUE(removed.empty());
+    EXPECT_EQ(varsOf(row1), std::vector<LVRef>({x1, y1, x2, y2}));
+    EXPECT_EQ(row1.getCoeff(x1), 1);
+    EXPECT_EQ(row1.getCoeff(y1), -3);
+    EXPECT_EQ(row1.getCoeff(x2), -1);
+    EXPECT_EQ(row1.getCoeff(y2), 3);
+}
+
+TEST_F(TableauRowTest, test_MergeWithCancellation) {
+    LVRef a {1};
+    LVRef b {2};
+    LVRef c {3};
+    LVRef d {4};
+    LVRef e {5};
+    row1.addTerm(a, 1);
+    row1.addTerm(b, 2);
+    row1.addTerm(d, -4);
+    row2.addTerm(b, -1);
+    row2.addTerm(c, 1);
+    row2.addTerm(d, 2);
+    row2.addTerm(e, 1);
+    merge(2);
+    ASSERT_EQ(removed.size(), 2);
+    EXPECT_EQ(added.size(), 2);
+    EXPECT_EQ(varsOf(row1), std::vector<LVRef>({a, c, e}));
+    EXPECT_EQ(row1.getCoeff(a), 1);
+    EXPECT_EQ(row1.getCoeff(c), 2);
+    EXPECT_EQ(row1.getCoeff(e), 2);
+}
+
+TEST_F(TableauRowTest, test_MergeToEmpty) {
+    LVRef x {1};
+    LVRef y {2};
+    row1.addTerm(x, 1);
+    row1.addTerm(y, -1);
+    row2.addTerm(x, -1);
+    row2.addTerm(y, 1);
+    merge(1);
+    EXPECT_EQ(row1.size(), 0);
+    EXPECT_EQ(removed.size(), 2);
+}
+
+TEST_F(TableauRowTest, test_MergeStats) {
+    LVRef x {1};
+    LVRef y {2};
+    row1.addTerm(x, INT_MAX);
+    row2.addTerm(x, 1);
+    row2.addTerm(y, FastRational(1, 3));
+    merge(FastRational(3, 2));
+    EXPECT_EQ(stats.wordOps, 1);
+    EXPECT_EQ(stats.rationalOps, 1);
+    EXPECT_EQ(row1.getCoeff(x), FastRational(INT_MAX) + FastRational(3, 2));
+    EXPECT_EQ(row1.getCoeff(y), FastRational(1, 2));
+}
+
+TEST_F(TableauRowTest, test_MergeIntegerRowsOutOfWordRange) {
+    LVRef x {1};
+    LVRef y {2};
+    LVRef z {3};
+    LVRef big {4};
+    row1.addTerm(x, INT_MAX);
+    row1.addTerm(y, 1);
+    row1.addTerm(big, FastRational(INT_MAX) * 2);
+    row2.addTerm(x, 1);
+    row2.addTerm(y, -1);
+    row2.addTerm(z, INT_MAX);
+    row2.addTerm(big, 1);
+    merge(2);
+    EXPECT_EQ(varsOf(row1), std::vector<LVRef>({x, y, z, big}));
+    EXPECT_EQ(row1.getCoeff(x), FastRational(INT_MAX) + 2);
+    EXPECT_EQ(row1.getCoeff(y), -1);
+    EXPECT_EQ(row1.getCoeff(z), FastRational(INT_MAX) * 2);
+    EXPECT_EQ(row1.getCoeff(big), FastRational(INT_MAX) * 2 + 2);
+    // Only y was computed in words
+    EXPECT_EQ(stats.wordOps, 1);
+    EXPECT_EQ(stats.rationalOps, 3);
+}
+
+TEST(Tableau_test, test_Pivot) {
+    LVRef x {0};
+    LVRef y {1};
+    LVRef z {2};
+    LVRef s {3};
+    LVRef t {4};
+    Tableau tableau;
+    tableau.newNonbasicVar(x);
+    tableau.newNonbasicVar(y);
+    tableau.newNonbasicVar(z);
+    auto p_s = std::make_unique<PolynomialT<LVRef>>(); // s = x + y
+    p_s->addTerm(x, 1);
+    p_s->addTerm(y, 1);
+    auto p_t = std::make_unique<PolynomialT<LVRef>>(); // t = x - z
+    p_t->addTerm(x, 1);
+    p_t->addTerm(z, -1);
+    tableau.newRow(s, std::move(p_s));
+    tableau.newRow(t, std::move(p_t));
+    tableau.quasiToBasic(s);
+    tableau.quasiToBasic(t);
+    ASSERT_TRUE(tableau.checkConsistency());
+
+    tableau.pivot(s, x); // x = s - y and t = s - y - z
+    EXPECT_TRUE(tableau.isBasic(x));
+    EXPECT_TRUE(tableau.isNonBasic(s));
+    EXPECT_TRUE(tableau.checkConsistency());
+    EXPECT_EQ(tableau.getPolySize(t), 3);
+    EXPECT_EQ(tableau.getCoeff(t, s), 1);
+    EXPECT_EQ(tableau.getCoeff(t, y), -1);
+    EXPECT_EQ(tableau.getCoeff(t, z), -1);
+    EXPECT_EQ(tableau.getColumn(s).size(), 2);
+
+    tableau.pivot(t, y); // y = s - t - z and x = t + z
+    EXPECT_TRUE(tableau.checkConsistency());
+    EXPECT_EQ(tableau.getPolySize(x), 2);
+    EXPECT_EQ(tableau.getCoeff(x, t), 1);
+    EXPECT_EQ(tableau.getCoeff(x, z), 1);
+    EXPECT_EQ(tableau.getColumn(s).size(), 1);
+}